@@ -69,12 +69,26 @@ public:
     return getOptions<ConstraintTraits<ConcreteConstraint>::secondarySize>(secondaryOptions);
   }
 
+  /** @see ConstraintInterface::getDigitClass() */
+  virtual uint32_t getDigitClass(Digit digit) const override {
+    return ConcreteConstraint::digitClass(digit);
+  }
+
   /** @see ConstraintInterface::getSvgGroup() */
   virtual std::unique_ptr<SvgGroup>
   getSvgGroup([[maybe_unused]] const DrawingOptions<puzzle.getPuzzleSpace()>& options) const override {
     return std::make_unique<SvgGroup>(getName(), std::nullopt, std::nullopt, std::nullopt);
   }
 
+  /** Computes the class of a digit, see ConstraintInterface::getDigitClass(). All digits play the same role, unless the
+   * derived constraint hides this function with its own.
+   * @param digit The digit
+   * @return The class of the digit
+   */
+  static constexpr uint32_t digitClass([[maybe_unused]] uint32_t digit) {
+    return 0;
+  }
+
 private:
   /** Creates the options (primary or secondary) according to the given optionFunction.
    * If all the options are empty, returns an empty optional
@@ -50,6 +50,13 @@ struct ConstraintInterface {
    */
   virtual const std::optional<OptionsSpan<puzzle>> getSecondaryOptions() const = 0;
 
+  /** Retrieves the class of a digit. Digits of the same class play the same role in the constraint: swapping two of
+   * them everywhere in a grid that satisfies the constraint gives another grid that satisfies it.
+   * @param digit The digit
+   * @return The class of the digit
+   */
+  virtual uint32_t getDigitClass(Digit digit) const = 0;
+
   /** Retrieves the SvgGroup of the constraint
    * @param options The drawing options
    * @return The SvgGroup
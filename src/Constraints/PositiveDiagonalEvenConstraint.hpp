@@ -35,6 +35,11 @@ public:
     return {};
   }
 
+  /** @see Constraint::digitClass(), only the even digits can go on the diagonal */
+  static constexpr uint32_t digitClass(uint32_t digit) {
+    return Digits::isEven(digit) ? 1 : 0;
+  }
+
   virtual std::unique_ptr<SvgGroup> getSvgGroup(const DrawingOptions<puzzle.getPuzzleSpace()>& options) const override {
     auto group = std::make_unique<SvgGroup>(this->getName(), std::nullopt, "black", options.thinLine);
     group->add(std::make_unique<SvgSquigglyLine>(0, options.height, options.width, 0, options.cellSize / 10.0));
@@ -0,0 +1,66 @@
+#include "AlgorithmC.hpp"
+#include "SsxccFormat.hpp"
+#include "Timer.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+/** Solves every problem of a directory, written in the text format of Knuth's SSXCC program, and reports how many
+ * solutions each one has and how long the search took. Files are solved in the order of their names, so that two runs
+ * on the same corpus can be compared line by line.
+ *
+ * Usage: ku_corpus_runner <directory> [seed]
+ */
+int main(int argc, char* argv[]) {
+  if (argc < 2 || argc > 3) {
+    std::cerr << "Usage: " << argv[0] << " <directory> [seed]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::filesystem::path directory = argv[1];
+  const std::optional<int32_t> seed = argc == 3 ? std::optional<int32_t>(std::stoi(argv[2])) : std::nullopt;
+
+  std::error_code error;
+  std::vector<std::filesystem::path> paths;
+  for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+    if (entry.is_regular_file()) {
+      paths.push_back(entry.path());
+    }
+  }
+  if (error) {
+    std::cerr << "Cannot list " << directory << ": " << error.message() << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::ranges::sort(paths);
+
+  bool hasFailed = false;
+  double totalSeconds = 0;
+  std::cout << "file\titems\toptions\tsolutions\tseconds" << std::endl;
+  for (const auto& path : paths) {
+    try {
+      std::ifstream input(path);
+      if (!input) {
+        throw std::runtime_error(std::string("Cannot open the file"));
+      }
+      const auto problem = SsxccFormat::read(input);
+      const auto structure = problem.createStructure();
+      const Timer timer;
+      const auto solutionsCount = AlgorithmC::countSolutions(structure, seed, {});
+      const double seconds = timer.elapsed();
+      totalSeconds += seconds;
+      std::cout << path.filename().string() << '\t' << structure.itemsCount << '\t' << structure.optionsCount << '\t'
+                << solutionsCount << '\t' << seconds << std::endl;
+    } catch (const std::exception& exception) {
+      hasFailed = true;
+      std::cerr << path.filename().string() << ": " << exception.what() << std::endl;
+    }
+  }
+  std::cout << "total\t\t\t\t" << totalSeconds << std::endl;
+  return hasFailed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -1,20 +1,37 @@
 #pragma once
 
 #include "AlgorithmC.hpp"
+#include "BitsetSolver.hpp"
 #include "ConstraintFactory.hpp"
 #include "DancingCellsStructure.hpp"
 #include "DataStructureDrawing.hpp"
 #include "GridUtilities.hpp"
 #include "IdPacking.hpp"
+#include "Preprocessing.hpp"
 #include "PuzzleDrawing.hpp"
 #include "PuzzleIntrinsics.hpp"
+#include "RandomGenerator.hpp"
+#include "XccOptions.hpp"
 
+#include <algorithm>
 #include <filesystem>
 #include <iostream>
 #include <ranges>
+#include <tuple>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
+/** How a puzzle deals with the symmetries of its constraints while searching.
+ */
+enum class SymmetryBreaking {
+  /// The whole search space is searched
+  None,
+  /// An empty grid whose digits all play the same role is searched up to a relabeling of its digits, see
+  /// Puzzle::createCanonicalGrid()
+  DigitRelabeling,
+};
+
 /** The base class for grid-like puzzles where a single digit goes in each cell.
  * @tparam rowsCount The amount of rows in the grid.
  * @tparam columnsCount The amount of columns in the grid.
@@ -28,16 +45,23 @@ public:
    * @param givenGrid The starting grid of the puzzle.
    * @param constraintTypes The constraints to use when generating the puzzle.
    * @param seed The seed for the random number generator used when generating the puzzle.
+   * @param symmetryBreaking How the symmetries of the constraints are used to shrink the search.
+   * @param restartStrategy When the search for a solution is restarted with another seed, see
+   * AlgorithmC::BasicSolver::findOneSolutionWithRestarts(). Never restarts if not available.
    */
   constexpr Puzzle(const std::string& name,
                    const Grid<puzzleSpace>& givenGrid,
                    ConstraintType constraintTypes,
-                   std::optional<int32_t> seed)
+                   std::optional<int32_t> seed,
+                   SymmetryBreaking symmetryBreaking = SymmetryBreaking::None,
+                   std::optional<AlgorithmC::RestartStrategy> restartStrategy = std::nullopt)
       : PuzzleIntrinsics<puzzleSpace>()
       , name(name)
       , startingGrid(givenGrid)
       , constraints(createConstraints(constraintTypes))
       , seed(seed)
+      , symmetryBreaking(symmetryBreaking)
+      , restartStrategy(restartStrategy)
       , possibilities(constructActualPossibilities())
       , structure(createStructure())
       , solution(solve()) {};
@@ -90,6 +114,172 @@ public:
   };
 
   DancingCellsStructure createStructure() const {
+    const auto [primaryItemsCount, secondaryItemsCount, options] = createOptions();
+    return DancingCellsStructure(primaryItemsCount, secondaryItemsCount, options.elements(), options.offsets());
+  }
+
+  /** Creates the XCC problem of the puzzle, after settling what the givens force, see Preprocessing::reduceProblem().
+   * @return The reduced problem, whose original option indices are indices of possibilities.
+   */
+  Preprocessing::ReducedProblem createReducedProblem() const {
+    const auto [primaryItemsCount, secondaryItemsCount, options] = createOptions();
+    return Preprocessing::reduceProblem(primaryItemsCount, secondaryItemsCount, options);
+  }
+
+  /** Computes whether the puzzle has exactly one solution. Puzzles of a puzzle space small enough for the bitset solver
+   * are checked with it, the others with Algorithm C.
+   * @return Whether exactly one solution exists.
+   */
+  bool hasUniqueSolution() const {
+    if constexpr (isBitsetSolverPreferred<puzzleSpace>) {
+      if (PuzzleBitsetSolver<puzzleSpace>::fits(structure)) {
+        return PuzzleBitsetSolver<puzzleSpace>(structure).hasUniqueSolution().has_value();
+      }
+    }
+    return AlgorithmC::hasUniqueSolution(structure, seed).has_value();
+  }
+
+  /** Computes which digits play the same role in every constraint of the puzzle. Relabeling the digits of a class among
+   * each other in a grid that satisfies every constraint gives another such grid.
+   * @return For every digit, in increasing order, its class.
+   */
+  std::vector<uint32_t> computeDigitClasses() const {
+    // Digits that are in the same class for every constraint share a class
+    std::vector<std::vector<uint32_t>> signatures;
+    std::vector<uint32_t> digitClasses;
+    for (const auto digit : this->digits) {
+      std::vector<uint32_t> signature;
+      for (const auto& constraint : constraints) {
+        signature.push_back(constraint->getDigitClass(digit));
+      }
+      const auto found = std::ranges::find(signatures, signature);
+      digitClasses.push_back(static_cast<uint32_t>(found - signatures.begin()));
+      if (found == signatures.end()) {
+        signatures.push_back(std::move(signature));
+      }
+    }
+    return digitClasses;
+  }
+
+  /** Creates the grid that breaks the digit symmetry of an empty grid. Any solution can be relabeled into exactly one
+   * solution in which the first row, column or box holds the digits in increasing order, provided that a constraint
+   * makes it contain every digit exactly once and that all digits play the same role.
+   * @return The starting grid with that unit filled in. Empty if the starting grid has givens, if some digits play
+   * different roles, or if no constraint makes a unit contain every digit.
+   */
+  std::optional<Grid<puzzleSpace>> createCanonicalGrid() const {
+    const auto isEmpty = [](const auto& row) { return std::ranges::none_of(row, Digits::isValid); };
+    const auto digitClasses = computeDigitClasses();
+    if (!std::ranges::all_of(startingGrid, isEmpty) ||
+        std::ranges::any_of(digitClasses, [](uint32_t digitClass) { return digitClass != 0; })) {
+      return {};
+    }
+    for (const auto& constraint : constraints) {
+      auto grid = Grid<puzzleSpace>{};
+      for (std::size_t i = 0; i < this->digits.size(); i++) {
+        switch (constraint->getType()) {
+        case ConstraintType::EXACT_ROW:
+          grid[0][i] = this->digits[i];
+          break;
+        case ConstraintType::EXACT_COLUMN:
+          grid[i][0] = this->digits[i];
+          break;
+        case ConstraintType::EXACT_3x3_BOXES:
+          grid[i / 3][i % 3] = this->digits[i];
+          break;
+        default:
+          break;
+        }
+      }
+      if (grid != startingGrid) {
+        return grid;
+      }
+    }
+    return {};
+  }
+
+  /** Computes how many solutions every solution of the canonical grid stands for, see createCanonicalGrid().
+   * @return The amount of relabelings of the digits when breaking digit symmetry, otherwise one.
+   */
+  int64_t computeSymmetryOrbitSize() const {
+    if (symmetryBreaking != SymmetryBreaking::DigitRelabeling || !createCanonicalGrid().has_value()) {
+      return 1;
+    }
+    int64_t orbitSize = 1;
+    for (int64_t i = 2; i <= static_cast<int64_t>(this->digits.size()); i++) {
+      orbitSize *= i;
+    }
+    return orbitSize;
+  }
+
+  /** Counts all solutions of the puzzle. When breaking digit symmetry, only the solutions of the canonical grid are
+   * searched, each of which stands for as many solutions as there are relabelings of the digits.
+   * @return The amount of solutions.
+   */
+  int64_t countSolutions() const {
+    if (symmetryBreaking == SymmetryBreaking::DigitRelabeling) {
+      if (const auto canonicalGrid = createCanonicalGrid()) {
+        // The digits of the canonical grid are forced into the search on the structure of the puzzle itself
+        const auto canonicalOptions = findOptionIndices(canonicalGrid.value());
+        const auto solutionsCount = AlgorithmC::withFittingSolver(structure, [&](auto& solver) {
+          solver.forceOptions(canonicalOptions);
+          return solver.countSolutions(seed, {});
+        });
+        return solutionsCount * computeSymmetryOrbitSize();
+      }
+    }
+    return AlgorithmC::countSolutions(structure, seed, {});
+  }
+
+  Grid<puzzleSpace> solve() {
+    auto solution = Grid<puzzleSpace>{};
+
+    // When breaking digit symmetry, complete the canonical grid instead, then relabel its digits at random
+    std::optional<std::vector<int32_t>> canonicalOptions;
+    if (symmetryBreaking == SymmetryBreaking::DigitRelabeling) {
+      if (const auto canonicalGrid = createCanonicalGrid()) {
+        canonicalOptions = findOptionIndices(canonicalGrid.value());
+      }
+    }
+
+    // Find a possible solution. Heavily constrained variants can take very long after an unlucky choice near the root
+    // of the search tree, which restarting with another seed avoids if requested.
+    const auto solutionOptional = AlgorithmC::withFittingSolver(structure, [&](auto& solver) {
+      if (canonicalOptions.has_value()) {
+        solver.forceOptions(canonicalOptions.value());
+      }
+      auto foundSolution = restartStrategy.has_value()
+                               ? solver.findOneSolutionWithRestarts(seed, restartStrategy.value())
+                               : solver.findOneSolution(seed);
+      solverStatistics = solver.statistics();
+      return foundSolution;
+    });
+
+    if (!solutionOptional.has_value()) {
+      std::cout << "Cannot find a solution" << std::endl;
+    }
+    if (solutionOptional.has_value()) {
+      const auto& options = solutionOptional.value();
+      if (options.size() != puzzleSpace.columnsCount * puzzleSpace.rowsCount) {
+        throw std::runtime_error(std::string("Solution found does not cover the entire grid."));
+      }
+
+      // Reduce structure's solution back to a grid:
+      // Datastructure was created with available possibilities, options were given from first to last
+      for (const auto id : options) {
+        const auto& [row, column, digit] = possibilities[id];
+        solution[row][column] = digit;
+      }
+    }
+
+    return canonicalOptions.has_value() ? relabelDigits(solution) : solution;
+  }
+
+private:
+  /** Creates the items and options of the XCC problem of the puzzle, one option for every possibility
+   * @return The amount of primary items, the amount of secondary items, and the options
+   */
+  std::tuple<int32_t, int32_t, XccOptions> createOptions() const {
     int32_t primaryItemsCount = 0;
     int32_t secondaryItemsCount = 0;
     auto idOffsets = std::vector<std::pair<int32_t, int32_t>>(constraints.size() + 1, {0, 0});
@@ -114,19 +304,30 @@ public:
       optionsSpan.emplace_back(constraint->getPrimaryOptions(), constraint->getSecondaryOptions());
     }
 
-    std::vector<std::vector<XccElement>> options;
-    options.reserve(possibilities.size());
-    for (const auto& [i, j, possibleDigit] : possibilities) {
-      const int32_t globalOptionId = IdPacking::packId(
-          i, j, possibleDigit - 1, puzzleSpace.rowsCount, puzzleSpace.columnsCount, puzzleSpace.digitsCount);
-      std::vector<XccElement> option;
-      option.reserve(computeOptionSize(optionsSpan, globalOptionId));
+    const auto computeGlobalOptionId = [](const Cell& possibility) {
+      return IdPacking::packId(possibility.rowIndex,
+                               possibility.columnIndex,
+                               possibility.digit - 1,
+                               puzzleSpace.rowsCount,
+                               puzzleSpace.columnsCount,
+                               puzzleSpace.digitsCount);
+    };
+
+    // All options are written one after the other into the same array, which is allocated once up front
+    std::size_t elementsCount = 0;
+    for (const auto& possibility : possibilities) {
+      elementsCount += computeOptionSize(optionsSpan, computeGlobalOptionId(possibility));
+    }
+    XccOptions options;
+    options.reserve(possibilities.size(), elementsCount);
+    for (const auto& possibility : possibilities) {
+      const int32_t globalOptionId = computeGlobalOptionId(possibility);
       int32_t constraintId = 0;
       for (const auto& constraint : constraints) {
         if (constraint->getPrimaryItemsAmount() > 0 && optionsSpan[constraintId].first.has_value()) {
           const auto& primaryItems = optionsSpan[constraintId].first.value();
           for (const auto& primaryItemId : primaryItems[globalOptionId]) {
-            option.emplace_back(idOffsets[constraintId].first + primaryItemId);
+            options.addElement(XccElement(idOffsets[constraintId].first + primaryItemId));
           }
         }
         constraintId++;
@@ -136,46 +337,16 @@ public:
         if (constraint->getSecondaryItemsAmount() > 0 && optionsSpan[constraintId].second.has_value()) {
           const auto& secondaryItems = optionsSpan[constraintId].second.value();
           for (const auto& secondaryItemId : secondaryItems[globalOptionId]) {
-            option.emplace_back(idOffsets[constraintId].second + secondaryItemId);
+            options.addElement(XccElement(idOffsets[constraintId].second + secondaryItemId));
           }
         }
         constraintId++;
       }
-      options.emplace_back(option);
-    }
-    return DancingCellsStructure(primaryItemsCount, secondaryItemsCount, options);
-  }
-
-  Grid<puzzleSpace> solve() {
-    auto solution = Grid<puzzleSpace>{};
-
-    auto structureCopy = structure;
-    // Find a possible solution
-    const auto solutionOptional = AlgorithmC::findOneSolution(structureCopy, seed);
-
-    if (!solutionOptional.has_value()) {
-      std::cout << "Cannot find a solution" << std::endl;
-    }
-    if (solutionOptional.has_value()) {
-      const auto& options = solutionOptional.value();
-      if (options.size() != puzzleSpace.columnsCount * puzzleSpace.rowsCount) {
-        throw std::runtime_error(std::string("Solution found does not cover the entire grid."));
-      }
-
-      // Reduce structure's solution back to a grid:
-      // Datastructure was created with available possibilities, options were given from first to last
-      for (const auto [id, cell] : std::ranges::views::enumerate(possibilities)) {
-        if (options.contains(id)) {
-          const auto& [row, column, digit] = cell;
-          solution[row][column] = digit;
-        }
-      }
+      options.finishOption();
     }
-
-    return solution;
+    return {primaryItemsCount, secondaryItemsCount, std::move(options)};
   }
 
-private:
   /** Constructs the list of constraints
    * @param constraintTypes A bitflag of the constraints
    * @return The list of constructed constraints
@@ -201,6 +372,42 @@ private:
     return constraintList;
   }
 
+  /** Finds the options that place the digits of a grid, which are the indices of their possibilities.
+   * @param grid The grid, whose empty cells hold the invalid digit. Every digit in it must have a possibility.
+   * @return The indices of the options, in the order of the cells.
+   */
+  std::vector<int32_t> findOptionIndices(const Grid<puzzleSpace>& grid) const {
+    std::vector<int32_t> optionIndices;
+    for (std::size_t optionIndex = 0; optionIndex < possibilities.size(); optionIndex++) {
+      const auto& [row, column, digit] = possibilities[optionIndex];
+      if (grid[row][column] == digit) {
+        optionIndices.push_back(static_cast<int32_t>(optionIndex));
+      }
+    }
+    return optionIndices;
+  }
+
+  /** Applies a random permutation of the digits to a grid, drawn from the seed of the puzzle
+   * @param grid The grid
+   * @return The grid with its digits permuted, its empty cells stay empty
+   */
+  Grid<puzzleSpace> relabelDigits(const Grid<puzzleSpace>& grid) const {
+    auto permutation = this->digits;
+    RandomGenerator randomGenerator(seed);
+    for (int32_t i = static_cast<int32_t>(permutation.size()) - 1; i > 0; i--) {
+      std::swap(permutation[i], permutation[randomGenerator.uniformInteger(0, i)]);
+    }
+    auto relabeledGrid = grid;
+    for (auto& row : relabeledGrid) {
+      for (auto& digit : row) {
+        if (Digits::isValid(digit)) {
+          digit = permutation[digit - 1];
+        }
+      }
+    }
+    return relabeledGrid;
+  }
+
   /** Selects only the valid clues out of the provided ones
    * @param clues A list of clues
    * @return The same list, but only with valid clues
@@ -246,12 +453,22 @@ public:
   /// The seed for the random number generator
   const std::optional<int32_t> seed;
 
+  /// How the symmetries of the constraints are used to shrink the search
+  const SymmetryBreaking symmetryBreaking = SymmetryBreaking::None;
+
+  /// When the search for a solution is restarted with another seed, never if not available
+  const std::optional<AlgorithmC::RestartStrategy> restartStrategy;
+
   /// The list of available possiblities taking into account cells with given values
   const std::vector<Cell> possibilities;
 
   /// The data structure required for solving the puzzle
   const DancingCellsStructure structure;
 
+  /// What the solver did to find the solution, only recorded when AlgorithmC::areStatisticsEnabled. With restarts, only
+  /// the last attempt is described.
+  AlgorithmC::SearchStatistics solverStatistics;
+
   /// The solution to the puzzle
   const Grid<puzzleSpace> solution = {};
 };
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "AlgorithmC.hpp"
+#include "Puzzle.hpp"
+
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+/** Solves many grids of the same puzzle space and constraints, one after the other. The structure of the puzzle without
+ * any givens is built once, and the givens of every grid are forced into the search as the options that it chooses at
+ * its first levels, see AlgorithmC::BasicSolver::forceOptions(). Neither the constraints nor the structure are rebuilt
+ * for every grid, which is what constructing a Puzzle for every grid spends most of its time on.
+ * @tparam puzzleSpace The puzzle space of every grid.
+ */
+template <PuzzleSpace puzzleSpace>
+class PuzzleBatchSolver {
+public:
+  /** Constructor
+   * @param constraintTypes The constraints of every grid.
+   * @param seed The seed for the random number generator, used for every grid.
+   * @param restartStrategy When the search for a solution of a grid is restarted with another seed, see
+   * AlgorithmC::BasicSolver::findOneSolutionWithRestarts(). Never restarts if not available, like Puzzle.
+   */
+  PuzzleBatchSolver(ConstraintType constraintTypes,
+                    std::optional<int32_t> seed,
+                    std::optional<AlgorithmC::RestartStrategy> restartStrategy = std::nullopt)
+      : puzzle("Batch", {}, constraintTypes, seed, SymmetryBreaking::None, restartStrategy)
+      , seed(seed)
+      , restartStrategy(restartStrategy)
+      , solver(createSolver(puzzle.structure))
+      , optionIndices(createOptionIndices()) {};
+
+  /** Finds a solution of a grid, like Puzzle::solve() does for a puzzle with that grid as its starting grid.
+   * @param givenGrid The grid, whose empty cells hold the invalid digit.
+   * @return A solution of the grid. Returns an empty optional if there are no solutions.
+   */
+  std::optional<Grid<puzzleSpace>> solve(const Grid<puzzleSpace>& givenGrid) {
+    if (!forceGivens(givenGrid)) {
+      return {};
+    }
+    const auto solution = std::visit(
+        [&](auto& fittingSolver) {
+          return restartStrategy.has_value() ? fittingSolver.findOneSolutionWithRestarts(seed, restartStrategy.value())
+                                             : fittingSolver.findOneSolution(seed);
+        },
+        solver);
+    if (!solution.has_value()) {
+      return {};
+    }
+    auto solvedGrid = Grid<puzzleSpace>{};
+    for (const auto optionIndex : solution.value()) {
+      const auto& [row, column, digit] = puzzle.possibilities[optionIndex];
+      solvedGrid[row][column] = digit;
+    }
+    return solvedGrid;
+  }
+
+  /** Computes whether a grid has exactly one solution, like Puzzle::hasUniqueSolution() does for a puzzle with that
+   * grid as its starting grid.
+   * @param givenGrid The grid, whose empty cells hold the invalid digit.
+   * @return Whether exactly one solution exists.
+   */
+  bool hasUniqueSolution(const Grid<puzzleSpace>& givenGrid) {
+    if (!forceGivens(givenGrid)) {
+      return false;
+    }
+    return std::visit([&](auto& fittingSolver) { return fittingSolver.hasUniqueSolution(seed).has_value(); }, solver);
+  }
+
+private:
+  /// Either solver finds the same solutions in the same order, the compact one is used whenever the structure fits it
+  using FittingSolver = std::variant<AlgorithmC::CompactSolver, AlgorithmC::Solver>;
+
+  /** Creates the solver with the narrowest indices that the structure fits in, see AlgorithmC::withFittingSolver().
+   * @param structure The structure of the puzzle without any givens.
+   * @return The solver, on which the structure is loaded.
+   */
+  static FittingSolver createSolver(const DancingCellsStructure& structure) {
+    return AlgorithmC::withFittingSolver(structure, [](auto& solver) { return FittingSolver(std::move(solver)); });
+  }
+
+  /** Maps every cell and digit to the option that places the digit in the cell.
+   * @return The index of the option for every cell and digit, see optionIndices.
+   */
+  std::vector<int32_t> createOptionIndices() const {
+    auto indices = std::vector<int32_t>(puzzleSpace.rowsCount * puzzleSpace.columnsCount * puzzleSpace.digitsCount, -1);
+    for (std::size_t optionIndex = 0; optionIndex < puzzle.possibilities.size(); optionIndex++) {
+      const auto& [row, column, digit] = puzzle.possibilities[optionIndex];
+      indices[(row * puzzleSpace.columnsCount + column) * puzzleSpace.digitsCount + digit - 1] =
+          static_cast<int32_t>(optionIndex);
+    }
+    return indices;
+  }
+
+  /** Forces the options of the givens of a grid into every following search.
+   * @param givenGrid The grid, whose empty cells hold the invalid digit.
+   * @return Whether every given has an option. Otherwise the grid has no solutions.
+   */
+  bool forceGivens(const Grid<puzzleSpace>& givenGrid) {
+    givenOptionIndices.clear();
+    for (std::size_t row = 0; row < puzzleSpace.rowsCount; row++) {
+      for (std::size_t column = 0; column < puzzleSpace.columnsCount; column++) {
+        const auto digit = givenGrid[row][column];
+        if (!Digits::isValid(digit)) {
+          continue;
+        }
+        if (!puzzle.isValidDigit(digit)) {
+          throw std::runtime_error(std::string("Invalid digit in the given grid."));
+        }
+        const int32_t optionIndex =
+            optionIndices[(row * puzzleSpace.columnsCount + column) * puzzleSpace.digitsCount + digit - 1];
+        if (optionIndex < 0) {
+          return false;
+        }
+        givenOptionIndices.push_back(optionIndex);
+      }
+    }
+    std::visit([&](auto& fittingSolver) { fittingSolver.forceOptions(givenOptionIndices); }, solver);
+    return true;
+  }
+
+  /// The puzzle without any givens, whose structure has an option for every possibility
+  const Puzzle<puzzleSpace> puzzle;
+
+  /// The seed for the random number generator
+  const std::optional<int32_t> seed;
+
+  /// When the search for a solution of a grid is restarted with another seed, never if not available
+  const std::optional<AlgorithmC::RestartStrategy> restartStrategy;
+
+  /// The solver on which the structure of the puzzle is loaded
+  FittingSolver solver;
+
+  /// The index of the option that places a digit in a cell, at (row * columns + column) * digits + digit - 1
+  const std::vector<int32_t> optionIndices;
+
+  /// Buffer in which the options of the givens of a grid are collected
+  std::vector<int32_t> givenOptionIndices;
+};
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "PuzzleIntrinsics.hpp"
+#include "StaticDancingCellsStructure.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/** Creates the structure of a puzzle without any givens at compile time, for puzzle spaces and constraints that are
+ * fixed when compiling. The structure is the same as the one of a Puzzle without any givens, provided that the
+ * constraints are listed in the order in which Puzzle::createConstraints() creates them: CellConstraint first, then
+ * the others by increasing ConstraintType. For instance a classic Sudoku:
+ *
+ *   constexpr auto& lists = StaticPuzzleStructure::lists<int32_t, PuzzleSpace{9, 9, 9}, CellConstraint,
+ *                                                        ExactRowConstraint, ExactColumnConstraint,
+ *                                                        Exact3x3BoxesConstraint>;
+ *   const auto structure = DancingCellsStructure(lists);
+ *
+ * The option of a possibility is at the index that IdPacking::packId() gives it, givens are forced into the search
+ * with AlgorithmC::BasicSolver::forceOptions(). Constraints whose options are expensive to compute, such as the pattern
+ * constraints on large grids, may exceed the limit that the compiler puts on constant evaluation.
+ */
+namespace StaticPuzzleStructure {
+
+/** The options of a puzzle, in a compressed sparse row layout.
+ */
+struct Options {
+  /// The amount of primary items
+  int32_t primaryItemsCount = 0;
+  /// The amount of secondary items
+  int32_t secondaryItemsCount = 0;
+  /// The item IDs of every option, one option after the other
+  std::vector<int32_t> itemIds;
+  /// Where every option starts in itemIds, followed by the amount of item IDs
+  std::vector<int32_t> offsets;
+};
+
+/** Counts the items of the options of a constraint, like Constraint::countUniqueElementsInOptions() does.
+ * @tparam puzzle The puzzle.
+ * @param optionFunction The static constexpr function of the constraint that creates a single option.
+ * @return Either the amount of unique IDs found, or the largest one. Which one is bigger.
+ */
+template <PuzzleIntrinsics puzzle>
+constexpr int32_t countItems(const auto& optionFunction) {
+  std::vector<int32_t> ids;
+  for (const auto& cell : puzzle.allPossibilities()) {
+    for (const auto id : optionFunction(static_cast<uint32_t>(cell.rowIndex),
+                                        static_cast<uint32_t>(cell.columnIndex),
+                                        static_cast<uint32_t>(cell.digit))) {
+      ids.push_back(static_cast<int32_t>(id));
+    }
+  }
+  if (ids.empty()) {
+    return 0;
+  }
+  std::ranges::sort(ids);
+  ids.erase(std::ranges::unique(ids).begin(), ids.end());
+  return std::max(ids.back(), static_cast<int32_t>(ids.size()));
+}
+
+/** Creates the options of every possibility of a puzzle, like Puzzle::createOptions() does for a puzzle without any
+ * givens.
+ * @tparam puzzleSpace The puzzle space.
+ * @tparam Constraints The constraints, in the order of their items.
+ * @return The options, one for every possibility.
+ */
+template <PuzzleSpace puzzleSpace, template <PuzzleIntrinsics> typename... Constraints>
+constexpr Options createOptions() {
+  constexpr auto puzzle = PuzzleIntrinsics<puzzleSpace>{};
+  static_assert((Constraints<puzzle>::supportsPuzzle() && ...), "Every constraint must support the puzzle space");
+
+  Options options;
+  const auto primaryItemsCounts = std::array{countItems<puzzle>(Constraints<puzzle>::primaryOption)...};
+  const auto secondaryItemsCounts = std::array{countItems<puzzle>(Constraints<puzzle>::secondaryOption)...};
+  auto primaryOffsets = std::array<int32_t, sizeof...(Constraints)>();
+  auto secondaryOffsets = std::array<int32_t, sizeof...(Constraints)>();
+  for (std::size_t constraintIndex = 0; constraintIndex < sizeof...(Constraints); constraintIndex++) {
+    primaryOffsets[constraintIndex] = options.primaryItemsCount;
+    options.primaryItemsCount += primaryItemsCounts[constraintIndex];
+  }
+  for (std::size_t constraintIndex = 0; constraintIndex < sizeof...(Constraints); constraintIndex++) {
+    secondaryOffsets[constraintIndex] = options.primaryItemsCount + options.secondaryItemsCount;
+    options.secondaryItemsCount += secondaryItemsCounts[constraintIndex];
+  }
+
+  const auto addItemIds = [&](const auto& option, int32_t idOffset) {
+    for (const auto id : option) {
+      options.itemIds.push_back(idOffset + static_cast<int32_t>(id));
+    }
+  };
+  options.offsets.push_back(0);
+  for (const auto& cell : puzzle.allPossibilities()) {
+    const auto row = static_cast<uint32_t>(cell.rowIndex);
+    const auto column = static_cast<uint32_t>(cell.columnIndex);
+    const auto digit = static_cast<uint32_t>(cell.digit);
+    // All primary items come first, then all secondary items, such that the IDs of every option are sorted
+    std::size_t constraintIndex = 0;
+    (addItemIds(Constraints<puzzle>::primaryOption(row, column, digit), primaryOffsets[constraintIndex++]), ...);
+    constraintIndex = 0;
+    (addItemIds(Constraints<puzzle>::secondaryOption(row, column, digit), secondaryOffsets[constraintIndex++]), ...);
+    options.offsets.push_back(static_cast<int32_t>(options.itemIds.size()));
+  }
+  return options;
+}
+
+/** Measures the options of every possibility of a puzzle, see createOptions().
+ * @tparam puzzleSpace The puzzle space.
+ * @tparam Constraints The constraints, in the order of their items.
+ * @return The amount of items, of options, and of item IDs of all options together.
+ */
+template <PuzzleSpace puzzleSpace, template <PuzzleIntrinsics> typename... Constraints>
+consteval std::array<std::size_t, 3> measureOptions() {
+  const auto options = createOptions<puzzleSpace, Constraints...>();
+  return {static_cast<std::size_t>(options.primaryItemsCount + options.secondaryItemsCount),
+          options.offsets.size() - 1,
+          options.itemIds.size()};
+}
+
+/** Creates the lists of the structure of a puzzle without any givens.
+ * @tparam Index The integer type of the indices, see BasicDancingCellsStructure.
+ * @tparam puzzleSpace The puzzle space.
+ * @tparam Constraints The constraints, in the order of their items.
+ * @return The lists, see StaticDancingCellsStructure.
+ */
+template <std::signed_integral Index, PuzzleSpace puzzleSpace, template <PuzzleIntrinsics> typename... Constraints>
+consteval auto createLists() {
+  // The sizes of the arrays have to be known before the options can be copied into them
+  constexpr auto sizes = measureOptions<puzzleSpace, Constraints...>();
+  const auto options = createOptions<puzzleSpace, Constraints...>();
+  return StaticDancingCellsStructure<Index, sizes[0], sizes[1], sizes[2]>::create(
+      options.primaryItemsCount, options.itemIds, options.offsets);
+}
+
+/** The lists of the structure of a puzzle without any givens, which are created at compile time and stored in the
+ * read-only data of the binary.
+ * @tparam Index The integer type of the indices, see BasicDancingCellsStructure.
+ * @tparam puzzleSpace The puzzle space.
+ * @tparam Constraints The constraints, in the order of their items.
+ */
+template <std::signed_integral Index, PuzzleSpace puzzleSpace, template <PuzzleIntrinsics> typename... Constraints>
+inline constexpr auto lists = createLists<Index, puzzleSpace, Constraints...>();
+
+} // namespace StaticPuzzleStructure
@@ -1,78 +1,27 @@
 #include "AlgorithmC.hpp"
 
 #include "RandomGenerator.hpp"
+#include "WorkStealing.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iterator>
 #include <limits>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <stop_token>
+#include <string>
+#include <utility>
+#include <vector>
 
 /** Helper functions for Algorithm C have been put here in an unnamed namespace such that they are only accessible by
  * this translation unit and nowhere else
  */
 namespace {
 
-/** Selects one the of the items with smallest length in the active list of the data structure. If there are
- * multiple items with the same smallest length, it selects one of those at random.
- * @param structure A reference to the structure currently being used
- * @param randomGenerator A reference to the random number generator being used
- * @param smallestSizeFoundSoFar A reference to the smallest size found so far, enter this function as the maximum
- * int32_t allowed.
- * @param bestItemIndex The item in the datastructure that has been picked by the MRV heuristic
- * @param active The amount of active items in the structure
- * @param second The index of the first secondary item in the structure
-F */
-void pickItemUsingMrvHeuristic(DancingCellsStructure& structure,
-                               RandomGenerator& randomGenerator,
-                               int32_t& smallestSizeFoundSoFar,
-                               int32_t& bestItemIndex,
-                               int32_t active,
-                               int32_t second) {
-  const auto selectThisItem = [&](int32_t itemIndex, int32_t sizeOfItem) {
-    bestItemIndex = structure.ITEM[itemIndex];
-    smallestSizeFoundSoFar = sizeOfItem;
-  };
-
-  int32_t smallestSizeNodesAmount = 0;
-  for (int32_t itemIndex = 0; smallestSizeFoundSoFar > 1 && itemIndex < active; itemIndex++) {
-    if (structure.ITEM[itemIndex] < second) {
-      int32_t sizeOfItem = structure.size(structure.ITEM[itemIndex]);
-      if (sizeOfItem < smallestSizeFoundSoFar) {
-        // New size is smaller than the smallest one found so far, select it
-        selectThisItem(itemIndex, sizeOfItem);
-        smallestSizeNodesAmount = 1;
-      } else if (sizeOfItem == smallestSizeFoundSoFar) {
-        // New size is equal to the smallest one found so far, randomly select it.
-        smallestSizeNodesAmount++;
-        // Chance to select this item is: one over the amount of items found so far with this smallest size.
-        // This ensures that every item with smallest size has an equal probability of being selected.
-        const bool needToSelectThisItem =
-            randomGenerator.uniformFloat(0.0f, 1.0f) < (1.0f / static_cast<float>(smallestSizeNodesAmount));
-        if (needToSelectThisItem) {
-          selectThisItem(itemIndex, sizeOfItem);
-        }
-      }
-    }
-  }
-};
-
-/** Computes sets of option indices that solve the problem described by the data structure
- * @param structure The structure that was used by Algorithm C
- * @param nodeIndicesSets The sets of node indices that describe the Exact Covering with Colors problem's solutions
- */
-std::vector<std::unordered_set<int32_t>>
-retrieveOptionIndices(const DancingCellsStructure& structure,
-                      const std::vector<std::unordered_set<int32_t>>& nodeIndicesSets) {
-
-  std::vector<std::unordered_set<int32_t>> solutions;
-  solutions.reserve(nodeIndicesSets.size());
-  for (const auto& nodeIndicesSet : nodeIndicesSets) {
-    std::unordered_set<int32_t> solution;
-    for (const auto value : nodeIndicesSet) {
-      solution.insert(structure.nodeOptionIndices.at(value));
-    }
-    solutions.push_back(solution);
-  }
-  return solutions;
-};
-
 /** Hide all of the incompatible options remaining in the set of a given item.
  * If check is true, this function returns zero if that would cause a primary item to be uncoverable.
  * @param structure A reference to the structure
@@ -82,19 +31,29 @@ retrieveOptionIndices(const DancingCellsStructure& structure,
  * @param previousActive
  * @param second
  * @param active
+ * @param saveStack The sizes of the items before they were changed, to which every changed size is pushed
+ * @param branching The branching policy, told about the new sizes of the active primary items if it tracks them
+ * @param statistics The statistics of the current search
  * @return Whether hiding the incompatible options is successful
  */
-bool hide(DancingCellsStructure& structure,
+template <std::signed_integral Index, AlgorithmC::BranchingPolicyConcept BranchingPolicy>
+bool hide(BasicDancingCellsStructure<Index>& structure,
           int32_t setBaseIndex,
           int32_t color,
           bool performEarlyExitIfPrimaryItemIsUncoverable,
           int32_t previousActive,
           int32_t second,
-          int32_t active) {
+          int32_t active,
+          std::vector<std::pair<Index, Index>>& saveStack,
+          BranchingPolicy& branching,
+          [[maybe_unused]] AlgorithmC::SearchStatistics& statistics) {
+  RECORD_STATISTICS(statistics.hideCallsCount++);
+  RECORD_STATISTICS(statistics.mems++);
   int32_t setIndex = setBaseIndex;
   int32_t size = setBaseIndex + structure.size(setBaseIndex);
 
   for (; setIndex < size; setIndex++) {
+    RECORD_STATISTICS(statistics.mems += 2);
     int32_t nodeIndex = structure.SET[setIndex];
     const bool isColorUndefined = !color;
     const bool doesNodeHaveDifferentColor = structure.NODE[nodeIndex].color != color;
@@ -102,6 +61,7 @@ bool hide(DancingCellsStructure& structure,
       //  remove option tt from the other sets it's in
       {
         for (int32_t siblingNodeIndex = nodeIndex + 1; siblingNodeIndex != nodeIndex;) {
+          RECORD_STATISTICS(statistics.mems++);
           int32_t siblingNodeItem = structure.NODE[siblingNodeIndex].item;
           if (siblingNodeItem < 0) {
             // This node is a spacer, loop back to the index in NODE that represents the first item in the option
@@ -109,8 +69,10 @@ bool hide(DancingCellsStructure& structure,
             continue;
           }
 
+          RECORD_STATISTICS(statistics.mems++);
           if (structure.position(siblingNodeItem) < previousActive) {
             // If the sibling node's item is active
+            RECORD_STATISTICS(statistics.mems++);
             int32_t newSize = structure.size(siblingNodeItem) - 1;
             const bool isLastNodeOfSiblingItem = newSize == 0;
             const bool isSiblingItemPrimary = siblingNodeItem < second;
@@ -125,7 +87,16 @@ bool hide(DancingCellsStructure& structure,
               return false;
             }
 
-            // Proceed with hiding the node of the sibling item
+            // Save the size to restore it when backtracking
+            saveStack.emplace_back(siblingNodeItem, newSize + 1);
+            if constexpr (AlgorithmC::IncrementalBranchingPolicyConcept<BranchingPolicy>) {
+              if (isSiblingItemPrimary && isSiblingItemActive) {
+                branching.resizeItem(siblingNodeItem, newSize + 1, newSize);
+              }
+            }
+
+            // Proceed with hiding the node of the sibling item: two reads and six writes
+            RECORD_STATISTICS(statistics.mems += 8);
             int32_t newNodeLocation = structure.SET[siblingNodeItem + newSize];
             int32_t siblingNodeLocation = structure.NODE[siblingNodeIndex].location;
             structure.size(siblingNodeItem) = newSize;
@@ -143,185 +114,332 @@ bool hide(DancingCellsStructure& structure,
   return true;
 }
 
-/** Runs Algorithm C on the internal data structure to find a solution.
- * @param findFirstSolution Whether a single solution suffices. When true this offers early exit as soon as the first
- * one is found
- * @param checkForUniqueness Whether confirming a unique solution is required. When true this offers early exit
- * if more than one solution is found.
- * @param dataStructure The sparse matrix that defines an Exact Cover problem
- * @return One or multiple sets of indices pointing to nodes in the data structure. The elements of these sets point
- * to the first nodes of options that are part of the solution found.
- */
-std::vector<std::unordered_set<int32_t>> runAlgorithmC(DancingCellsStructure& dataStructure,
-                                                       bool findFirstSolution,
-                                                       bool checkForUniqueness,
-                                                       const std::optional<int32_t>& seed) {
+} // namespace
 
-  // Don't run Algorithm C on an empty structure
-  if (dataStructure.optionsCount == 0) {
-    return {};
-  }
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+AlgorithmC::BasicSolver<BranchingPolicy, Index>::BasicSolver(const DancingCellsStructure& dataStructure,
+                                                             BranchingPolicy branchingPolicy)
+    : structure(dataStructure)
+    , initialItem(structure.ITEM)
+    , initialSet(structure.SET)
+    , initialNode(structure.NODE)
+    , choices(dataStructure.optionsCount, -1)
+    , saved(dataStructure.optionsCount + 1, 0)
+    , savedActive(dataStructure.optionsCount + 1, 0)
+    , optionIndices(dataStructure.optionsCount, -1)
+    , branching(std::move(branchingPolicy)) {}
 
-  // Get a copy of the structure to work on
-  auto structure = dataStructure;
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+void AlgorithmC::BasicSolver<BranchingPolicy, Index>::load(const DancingCellsStructure& dataStructure) {
+  // Assigning to the existing vectors reuses their memory whenever it is large enough
+  structure.assign(dataStructure);
+  initialItem = structure.ITEM;
+  initialSet = structure.SET;
+  initialNode = structure.NODE;
+  choices.assign(dataStructure.optionsCount, -1);
+  saved.assign(dataStructure.optionsCount + 1, 0);
+  savedActive.assign(dataStructure.optionsCount + 1, 0);
+  optionIndices.assign(dataStructure.optionsCount, -1);
+  optionNodes.clear();
+  forcedNodes.clear();
+  isModified = false;
+}
 
-  // The following vector will store the solutions, i.e. the sets of nodes which are contained by the options that
-  // solve the exact cover problem
-  std::vector<std::unordered_set<int32_t>> solutions;
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+void AlgorithmC::BasicSolver<BranchingPolicy, Index>::restore() {
+  if (isModified) {
+    // Only ITEM, SET and NODE are modified while searching, all of them keep their size
+    std::ranges::copy(initialItem, structure.ITEM.begin());
+    std::ranges::copy(initialSet, structure.SET.begin());
+    std::ranges::copy(initialNode, structure.NODE.begin());
+  }
+  isModified = true;
+}
 
-  // Initialize random generator to pick columns randomly according to a certain seed
-  RandomGenerator randomGenerator(seed);
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+void AlgorithmC::BasicSolver<BranchingPolicy, Index>::begin(const std::optional<int32_t>& seed,
+                                                            std::span<const int32_t> prefix,
+                                                            int32_t cutoffLevel) {
+  // Work on the structure as it was loaded, undoing whatever a previous search left behind
+  restore();
 
-  constexpr int32_t maxInt = std::numeric_limits<int32_t>::max();
+  // Let the branching policy prepare itself, e.g. initialize its random generator according to a certain seed
+  branching.start(structure, seed);
 
+  search.prefix = prefix;
+  search.cutoffLevel = cutoffLevel;
+  search.level = 0;
   // The currently active items are the ones to the left of the "active" index in the ITEM list.
-  int32_t active = structure.itemsCount;
+  search.active = structure.itemsCount;
   // Second is the internal number of the smallest secondary item (if any). Otherwise it's infinite.
-  int32_t second = structure.secondaryItemsCount <= 0 ? maxInt : structure.ITEM.at(structure.primaryItemsCount);
+  search.second = structure.secondaryItemsCount <= 0 ? std::numeric_limits<int32_t>::max()
+                                                     : structure.ITEM.at(structure.primaryItemsCount);
+  search.nodesCount = 0;
+  search.status = SearchStatus::Exhausted;
+  saveStack.clear();
+  // Every level covers at least one primary item
+  RECORD_STATISTICS(searchStatistics.reset(structure.primaryItemsCount + 1));
+  // Don't run Algorithm C on an empty structure
+  search.phase = structure.optionsCount == 0 ? SearchPhase::Finished : SearchPhase::Started;
+}
 
-  int32_t level = 0;
-  int32_t smallestItemSizeAvailable = 0;
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+void AlgorithmC::BasicSolver<BranchingPolicy, Index>::coverItem(int32_t itemIndex, int32_t& active, int32_t second) {
+  {
+    // Swap the item with the last of the active list, making it inactive
+    RECORD_STATISTICS(searchStatistics.mems += 6);
+    if constexpr (IncrementalBranchingPolicyConcept<BranchingPolicy>) {
+      branching.deactivateItem(itemIndex, structure.size(itemIndex));
+    }
+    int32_t currentItemIndex = active - 1;
+    active = currentItemIndex;
+    int32_t indexOfItem = structure.position(itemIndex);
+    int32_t setIndexOfCurrentItem = structure.ITEM[currentItemIndex];
+    structure.ITEM[currentItemIndex] = itemIndex;
+    structure.ITEM[indexOfItem] = setIndexOfCurrentItem;
+    structure.position(setIndexOfCurrentItem) = indexOfItem;
+    structure.position(itemIndex) = currentItemIndex;
+  }
 
-  // "Global" variables
-  int32_t previousActive = active; // Value of "active" just before items of the current option get deactivated
+  hide(structure, itemIndex, 0, false, active, second, active, saveStack, branching, searchStatistics);
+}
+
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+bool AlgorithmC::BasicSolver<BranchingPolicy, Index>::tryOption(int32_t currentNodeIndex,
+                                                                int32_t& active,
+                                                                int32_t second) {
+  // Value of "active" just before items of the current option get deactivated
+  const int32_t previousActive = active;
+  {
+    // Swap out all other items of currentNodeIndex
+    int32_t itemIndex = active;
+    for (int32_t siblingNodeIndex = currentNodeIndex + 1; siblingNodeIndex != currentNodeIndex;) {
+      RECORD_STATISTICS(searchStatistics.mems++);
+      int32_t siblingNodeItem = structure.NODE[siblingNodeIndex].item;
+      if (siblingNodeItem < 0) {
+        // siblingNodeItem is a spacer, jump to the previous item in the option
+        siblingNodeIndex += siblingNodeItem;
+      } else {
+        RECORD_STATISTICS(searchStatistics.mems++);
+        int32_t setIndexOfSiblingNodeItem = structure.position(siblingNodeItem);
+        if (setIndexOfSiblingNodeItem < itemIndex) {
+          // Swap out the item
+          RECORD_STATISTICS(searchStatistics.mems += 5);
+          if constexpr (IncrementalBranchingPolicyConcept<BranchingPolicy>) {
+            if (siblingNodeItem < second) {
+              branching.deactivateItem(siblingNodeItem, structure.size(siblingNodeItem));
+            }
+          }
+          int32_t previousItemIndex = structure.ITEM[--itemIndex];
+          structure.ITEM[itemIndex] = siblingNodeItem;
+          structure.ITEM[setIndexOfSiblingNodeItem] = previousItemIndex;
+          structure.position(previousItemIndex) = setIndexOfSiblingNodeItem;
+          structure.position(siblingNodeItem) = itemIndex;
+        }
+        siblingNodeIndex++;
+      }
+    }
+    active = itemIndex;
+  }
+
+  {
+    // Hide the other options of those items or abort
+    // A secondary item was purified at lower levels if and only if its position is >= previousActive
+    for (int32_t siblingNodeIndex = currentNodeIndex + 1; siblingNodeIndex != currentNodeIndex;) {
+      RECORD_STATISTICS(searchStatistics.mems++);
+      int32_t siblingNodeItem = structure.NODE[siblingNodeIndex].item;
+      if (siblingNodeItem < 0) {
+        // siblingNodeItem is a spacer, jump to the previous item in the option
+        siblingNodeIndex += siblingNodeItem;
+      } else {
+        if (siblingNodeItem < second) {
+          const bool isHideSuccessful = hide(structure,
+                                             siblingNodeItem,
+                                             0,
+                                             true,
+                                             previousActive,
+                                             second,
+                                             active,
+                                             saveStack,
+                                             branching,
+                                             searchStatistics);
+          if (!isHideSuccessful) {
+            RECORD_STATISTICS(searchStatistics.abortsCount++);
+            return false;
+          }
+        } else { // do nothing if cc already purified
+          RECORD_STATISTICS(searchStatistics.mems++);
+          int32_t pp = structure.position(siblingNodeItem);
+          if (pp < previousActive) {
+            const bool isHideSuccessful = hide(structure,
+                                               siblingNodeItem,
+                                               structure.NODE[siblingNodeIndex].color,
+                                               true,
+                                               previousActive,
+                                               second,
+                                               active,
+                                               saveStack,
+                                               branching,
+                                               searchStatistics);
+            if (!isHideSuccessful) {
+              RECORD_STATISTICS(searchStatistics.abortsCount++);
+              return false;
+            }
+          }
+        }
+        siblingNodeIndex++;
+      }
+    }
+  }
+  return true;
+}
+
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+void AlgorithmC::BasicSolver<BranchingPolicy, Index>::undoChanges(int32_t savedIndex,
+                                                                  int32_t savedActiveCount,
+                                                                  int32_t& active,
+                                                                  int32_t second) {
+  // Restore the sizes that were changed since then, the last change is undone first
+  RECORD_STATISTICS(searchStatistics.mems += static_cast<int32_t>(saveStack.size()) - savedIndex);
+  for (int32_t saveIndex = static_cast<int32_t>(saveStack.size()) - 1; saveIndex >= savedIndex; saveIndex--) {
+    const auto [itemIndex, size] = saveStack[saveIndex];
+    if constexpr (IncrementalBranchingPolicyConcept<BranchingPolicy>) {
+      if (itemIndex < second && structure.position(itemIndex) < active) {
+        branching.resizeItem(itemIndex, structure.size(itemIndex), size);
+      }
+    }
+    structure.size(itemIndex) = size;
+  }
+  saveStack.resize(savedIndex);
+
+  // The items that were made inactive since then become active again
+  if constexpr (IncrementalBranchingPolicyConcept<BranchingPolicy>) {
+    for (int32_t itemIndex = active; itemIndex < savedActiveCount; itemIndex++) {
+      if (structure.ITEM[itemIndex] < second) {
+        branching.reactivateItem(structure.ITEM[itemIndex], structure.size(structure.ITEM[itemIndex]));
+      }
+    }
+  }
+  active = savedActiveCount;
+}
 
-  // Trail is a sequential stack, stores data for backtracking faster, without recomputing previous values
-  auto TRAIL = std::vector<std::pair<int32_t, int32_t>>();
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+template <typename Visitor>
+void AlgorithmC::BasicSolver<BranchingPolicy, Index>::run(const std::optional<int32_t>& seed,
+                                                          std::span<const int32_t> prefix,
+                                                          int32_t cutoffLevel,
+                                                          Visitor&& visitor) {
+  begin(seed, prefix, cutoffLevel);
+  resume(std::forward<Visitor>(visitor));
+}
+
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+template <typename Visitor>
+void AlgorithmC::BasicSolver<BranchingPolicy, Index>::resume(Visitor&& visitor) {
+  if (search.phase == SearchPhase::Finished) {
+    return;
+  }
+
+  constexpr int32_t maxInt = std::numeric_limits<int32_t>::max();
+
+  // The registers of the search are kept in local variables while it runs, and stored back when it pauses
+  const std::span<const int32_t> prefix = search.prefix;
+  const int32_t cutoffLevel = search.cutoffLevel;
+  int32_t active = search.active;
+  const int32_t second = search.second;
+  int32_t level = search.level;
+  int32_t smallestItemSizeAvailable = 0;
+  // The levels at which the choice is dictated by the prefix
+  const int32_t prefixLevels = static_cast<int32_t>(prefix.size());
 
   // ALGORITHM C (Exact Covering with colors).
 
   int32_t bestItemIndex = 0;
   int32_t currentItemIndexChosen = 0;
   int32_t currentNodeIndex = 0; //
-  constexpr int32_t invalidChoice = -1;
-  // The node chosen on each level
-  std::vector<int32_t> choices(structure.optionsCount, invalidChoice);
-  // The size of savestack on each level
-  std::vector<int32_t> saved(structure.optionsCount + 1, 0);
-  auto saveStack = std::vector<std::pair<int32_t, int32_t>>();
-  int32_t currentSaveIndex = 0;
-
-  level = 0;
-Forward: {
-  smallestItemSizeAvailable = maxInt;
-  // set best_itm to the best item for branching
-  pickItemUsingMrvHeuristic(structure, randomGenerator, smallestItemSizeAvailable, bestItemIndex, active, second);
+  // The node chosen on each level, the size of saveStack and the amount of active items on each level and the saveStack
+  // itself are kept in the workspace, such that their memory is reused by the next search
 
-  const bool notAbleToPickItem = smallestItemSizeAvailable == maxInt;
-  if (notAbleToPickItem) {
-    // No item new item could be picked, therefore a solution was just found! Save it into the solutions vector.
-    // Only the first elements in the choices list are the those that need saving.
-    // The amount to save is equal to the current level, because a choice is made at every level.
-    solutions.emplace_back(choices.begin(), choices.begin() + level);
-
-    // Exit early if checking for uniqueness and more than one solution is found
-    const bool uniquenessEarlyExit = checkForUniqueness && solutions.size() >= 2;
-    // Exit early if it's not required to find all solutions and at least one has been found
-    const bool singleSolutionEarlyExit = findFirstSolution && solutions.size() >= 1;
-    if (singleSolutionEarlyExit || uniquenessEarlyExit) {
-      goto Done;
-    }
+  // The budget is checked every time a node of the search tree is entered, the deadline only periodically
+  constexpr int32_t nodesPerDeadlineCheck = 1024;
+  const int64_t maximumNodesCount = budget.maximumNodesCount.value_or(std::numeric_limits<int64_t>::max());
+  int64_t nodesCount = search.nodesCount;
+  int32_t nodesUntilDeadlineCheck = 0;
 
+  if (search.phase == SearchPhase::Paused) {
+    // The search was paused right after reporting a leaf, continue with the next branch
     goto Backup;
   }
-
-  {
-    // Swap the best item witht he last of the active list, making it inactive
-    int32_t currentItemIndex = active - 1;
-    active = currentItemIndex;
-    int32_t indexOfBestItem = structure.position(bestItemIndex);
-    int32_t setIndexOfCurrentItem = structure.ITEM[currentItemIndex];
-    structure.ITEM[currentItemIndex] = bestItemIndex;
-    structure.ITEM[indexOfBestItem] = setIndexOfCurrentItem;
-    structure.position(setIndexOfCurrentItem) = indexOfBestItem;
-    structure.position(bestItemIndex) = currentItemIndex;
+Forward: {
+  nodesCount++;
+  if (nodesCount > maximumNodesCount || budget.stopToken.stop_requested()) {
+    goto CutOff;
+  }
+  if (budget.deadline.has_value() && --nodesUntilDeadlineCheck <= 0) {
+    nodesUntilDeadlineCheck = nodesPerDeadlineCheck;
+    if (std::chrono::steady_clock::now() >= budget.deadline.value()) {
+      goto CutOff;
+    }
   }
 
-  {
-    previousActive = active;
-    hide(structure, bestItemIndex, 0, false, previousActive, second, active);
-    currentItemIndexChosen = bestItemIndex;
+  RECORD_STATISTICS(searchStatistics.nodesPerLevel[level]++);
+
+  if (level == cutoffLevel) {
+    // Don't descend any further, report the choices made so far instead
+    if (!visitor(std::span<const int32_t>(choices.begin(), choices.begin() + level))) {
+      goto Pause;
+    }
+    goto Backup;
   }
 
-  // Save the currently active sizes
-  {
-    if (static_cast<size_t>(currentSaveIndex + active + 1) > saveStack.size()) {
-      saveStack.resize(currentSaveIndex + active + 1);
+  smallestItemSizeAvailable = maxInt;
+  if (level < prefixLevels) {
+    // The item to branch on is the one of the option dictated by the prefix
+    bestItemIndex = structure.NODE[prefix[level]].item;
+    smallestItemSizeAvailable = structure.size(bestItemIndex);
+    RECORD_STATISTICS(searchStatistics.mems += 3);
+    if (structure.position(bestItemIndex) >= active ||
+        structure.NODE[prefix[level]].location >= bestItemIndex + smallestItemSizeAvailable) {
+      // The option was removed by one chosen above, forced options that conflict leave nothing to explore
+      goto Done;
     }
-    for (int32_t p = 0; p < active; p++) {
-      saveStack[currentSaveIndex + p] = {structure.ITEM[p], structure.size(structure.ITEM[p])};
+  } else {
+    // set best_itm to the best item for branching
+    branching.pickItem(structure, active, second, smallestItemSizeAvailable, bestItemIndex, searchStatistics);
+  }
+
+  const bool notAbleToPickItem = smallestItemSizeAvailable == maxInt;
+  if (notAbleToPickItem) {
+    // No item new item could be picked, therefore a solution was just found! Report it to the visitor.
+    // Only the first elements in the choices list are the those that describe it.
+    // The amount to report is equal to the current level, because a choice is made at every level.
+    RECORD_STATISTICS(searchStatistics.solutionsCount++);
+    if (!visitor(std::span<const int32_t>(choices.begin(), choices.begin() + level))) {
+      goto Pause;
     }
-    currentSaveIndex = currentSaveIndex + active;
-    saved[level + 1] = currentSaveIndex;
+
+    goto Backup;
   }
+
+  coverItem(bestItemIndex, active, second);
+  // Within the prefix, directly try the option that it dictates
+  currentItemIndexChosen = level < prefixLevels ? structure.NODE[prefix[level]].location : bestItemIndex;
+
+  // Mark the sizes that are changed from here on, they are restored up to this point when trying the next option
+  saved[level + 1] = static_cast<int32_t>(saveStack.size());
+  savedActive[level + 1] = active;
 }
 Advance: {
+  RECORD_STATISTICS(searchStatistics.mems++);
   choices[level] = structure.SET[currentItemIndexChosen];
   currentNodeIndex = choices[level];
 }
   // TryIt:
-  {
-    {
-      // Swap out all other items of currentNodeIndex
-      int32_t itemIndex = active;
-      previousActive = active;
-      for (int32_t siblingNodeIndex = currentNodeIndex + 1; siblingNodeIndex != currentNodeIndex;) {
-        int32_t siblingNodeItem = structure.NODE[siblingNodeIndex].item;
-        if (siblingNodeItem < 0) {
-          // siblingNodeItem is a spacer, jump to the previous item in the option
-          siblingNodeIndex += siblingNodeItem;
-        } else {
-          int32_t setIndexOfSiblingNodeItem = structure.position(siblingNodeItem);
-          if (setIndexOfSiblingNodeItem < itemIndex) {
-            // Swap out the item
-            int32_t previousItemIndex = structure.ITEM[--itemIndex];
-            structure.ITEM[itemIndex] = siblingNodeItem;
-            structure.ITEM[setIndexOfSiblingNodeItem] = previousItemIndex;
-            structure.position(previousItemIndex) = setIndexOfSiblingNodeItem;
-            structure.position(siblingNodeItem) = itemIndex;
-          }
-          siblingNodeIndex++;
-        }
-      }
-      active = itemIndex;
-    }
-
-    {
-      // Hide the other options of those items or goto abort
-      // A secondary item was purified at lower levels if and only if its position is >= previousActive
-      for (int32_t siblingNodeIndex = currentNodeIndex + 1; siblingNodeIndex != currentNodeIndex;) {
-        int32_t siblingNodeItem = structure.NODE[siblingNodeIndex].item;
-        if (siblingNodeItem < 0) {
-          // siblingNodeItem is a spacer, jump to the previous item in the option
-          siblingNodeIndex += siblingNodeItem;
-        } else {
-          if (siblingNodeItem < second) {
-            const bool isHideSuccessful = hide(structure, siblingNodeItem, 0, true, previousActive, second, active);
-            if (!isHideSuccessful) {
-              goto Abort;
-            }
-          } else { // do nothing if cc already purified
-            int32_t pp = structure.position(siblingNodeItem);
-            if (pp < previousActive) {
-              const bool isHideSuccessful = hide(structure,
-                                                 siblingNodeItem,
-                                                 structure.NODE[siblingNodeIndex].color,
-                                                 true,
-                                                 previousActive,
-                                                 second,
-                                                 active);
-              if (!isHideSuccessful) {
-                goto Abort;
-              }
-            }
-          }
-          siblingNodeIndex++;
-        }
-      }
-    }
-    level++;
-    goto Forward;
+  if (!tryOption(currentNodeIndex, active, second)) {
+    goto Abort;
   }
+  level++;
+  goto Forward;
 
 Backup: {
   // When the level reaches 0, all possible solutions have been evaluated
@@ -330,61 +448,623 @@ Backup: {
     goto Done;
   }
   level--;
+  RECORD_STATISTICS(searchStatistics.backtracksCount++);
+  RECORD_STATISTICS(searchStatistics.mems += 2);
   currentNodeIndex = choices[level];
   bestItemIndex = structure.NODE[currentNodeIndex].item;
   currentItemIndexChosen = structure.NODE[currentNodeIndex].location;
 }
 Abort: {
+  if (level < prefixLevels) {
+    // The options of the prefix are the only ones to explore at its levels
+    goto Done;
+  }
 
   if (currentItemIndexChosen + 1 >= bestItemIndex + structure.size(bestItemIndex)) {
     // Tried every option of the current best item
     goto Backup;
   }
 
-  {
-    // Restore the currently active sizes:
-    // Use savestack to restore the size of the current best item in the structure
-    currentSaveIndex = saved[level + 1];
-    active = currentSaveIndex - saved[level];
-    for (int32_t negativeItemIndex = -active; negativeItemIndex < 0; negativeItemIndex++) {
-      structure.size(saveStack[currentSaveIndex + negativeItemIndex].first) =
-          saveStack[currentSaveIndex + negativeItemIndex].second;
-    }
-  }
+  // Undo what the previous option changed since this level was entered
+  undoChanges(saved[level + 1], savedActive[level + 1], active, second);
   // There's still options available for the current best item: go to the next
   currentItemIndexChosen++;
   goto Advance;
 }
-Done: { return retrieveOptionIndices(structure, solutions); }
+Pause: {
+  // Store the registers needed to continue the search from Backup
+  search.level = level;
+  search.active = active;
+  search.nodesCount = nodesCount;
+  search.phase = SearchPhase::Paused;
+  search.status = SearchStatus::Stopped;
+  return;
+}
+CutOff: {
+  // The budget ran out before the whole search tree was explored
+  search.nodesCount = nodesCount;
+  search.phase = SearchPhase::Finished;
+  search.status = SearchStatus::CutOff;
+  return;
+}
+Done: {
+  search.nodesCount = nodesCount;
+  search.phase = SearchPhase::Finished;
+  search.status = SearchStatus::Exhausted;
+  return;
+}
 }
 
-} // namespace
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+std::span<const int32_t>
+AlgorithmC::BasicSolver<BranchingPolicy, Index>::toOptionIndices(std::span<const int32_t> nodeIndices) {
+  // Every solution is translated in the same buffer
+  for (std::size_t i = 0; i < nodeIndices.size(); i++) {
+    optionIndices[i] = structure.nodeOptionIndices[nodeIndices[i]];
+  }
+  return std::span<const int32_t>(optionIndices.data(), nodeIndices.size());
+}
 
-std::vector<std::unordered_set<int32_t>> AlgorithmC::findAllSolutions(DancingCellsStructure& dataStructure,
-                                                                      const std::optional<int32_t>& seed) {
-  // Algorithm C returns a list of node indices. These are the first nodes of the options which describe the solution
-  return runAlgorithmC(dataStructure, false, false, seed);
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+template <typename Visitor>
+AlgorithmC::SearchStatus
+AlgorithmC::BasicSolver<BranchingPolicy, Index>::visitSolutions(const std::optional<int32_t>& seed,
+                                                                std::span<const int32_t> prefix,
+                                                                Visitor&& visitor) {
+  run(seed, prefix, std::numeric_limits<int32_t>::max(), [&](std::span<const int32_t> nodeIndices) {
+    return visitor(toOptionIndices(nodeIndices));
+  });
+  return search.status;
 }
 
-std::optional<std::unordered_set<int32_t>> AlgorithmC::findOneSolution(DancingCellsStructure& dataStructure,
-                                                                       const std::optional<int32_t>& seed) {
-  // Algorithm C returns a list of node indices. These are the first nodes of the options which describe the solution
-  const auto solutions = runAlgorithmC(dataStructure, true, false, seed);
-  if (solutions.size() >= 1) {
-    return *solutions.begin();
-  }
-  return {};
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+std::vector<XccSolution>
+AlgorithmC::BasicSolver<BranchingPolicy, Index>::collectSolutions(const std::optional<int32_t>& seed,
+                                                                  std::span<const int32_t> prefix) {
+  // The following vector will store the solutions, i.e. the sets of options that solve the exact cover problem
+  std::vector<XccSolution> solutions;
+  visitSolutions(seed, prefix, [&](std::span<const int32_t> solution) {
+    solutions.emplace_back(solution);
+    return true;
+  });
+  return solutions;
 }
 
-std::optional<std::unordered_set<int32_t>> AlgorithmC::hasUniqueSolution(DancingCellsStructure& dataStructure,
-                                                                         const std::optional<int32_t>& seed) {
-  const auto solutions = runAlgorithmC(dataStructure, false, true, seed);
-  if (solutions.empty()) {
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+std::vector<std::vector<int32_t>>
+AlgorithmC::BasicSolver<BranchingPolicy, Index>::splitSearchTree(const std::optional<int32_t>& seed,
+                                                                 std::size_t minimumSubtreesCount,
+                                                                 int32_t maximumLevel) {
+  if (structure.optionsCount == 0) {
     return {};
   }
-  if (solutions.size() > 1) {
+  // Start with the whole tree
+  std::vector<std::vector<int32_t>> subtrees = {{}};
+  for (int32_t level = 0; level < maximumLevel && subtrees.size() < minimumSubtreesCount; level++) {
+    std::vector<std::vector<int32_t>> nextSubtrees;
+    for (const auto& subtree : subtrees) {
+      if (static_cast<int32_t>(subtree.size()) < level) {
+        // A solution was found above the current level, nothing left to split
+        nextSubtrees.push_back(subtree);
+        continue;
+      }
+      // Branch once more, every branch of the item chosen at this level becomes a subtree
+      run(seed, subtree, level + 1, [&](std::span<const int32_t> nodeIndices) {
+        nextSubtrees.emplace_back(nodeIndices.begin(), nodeIndices.end());
+        return true;
+      });
+    }
+    subtrees = std::move(nextSubtrees);
+  }
+  return subtrees;
+}
+
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+AlgorithmC::SearchStatus
+AlgorithmC::BasicSolver<BranchingPolicy, Index>::forEachSolution(const std::optional<int32_t>& seed,
+                                                                 const SolutionVisitor& visitor) {
+  return visitSolutions(seed, forcedNodes, visitor);
+}
+
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+std::vector<XccSolution>
+AlgorithmC::BasicSolver<BranchingPolicy, Index>::findAllSolutions(const std::optional<int32_t>& seed) {
+  return collectSolutions(seed, forcedNodes);
+}
+
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+int64_t AlgorithmC::BasicSolver<BranchingPolicy, Index>::countSolutions(const std::optional<int32_t>& seed,
+                                                                        const std::optional<int64_t>& limit) {
+  const int64_t maximumSolutionsCount = limit.value_or(std::numeric_limits<int64_t>::max());
+  if (maximumSolutionsCount <= 0) {
+    return 0;
+  }
+  // Only the amount of solutions is tracked, nothing is stored for them
+  int64_t solutionsCount = 0;
+  run(seed, forcedNodes, std::numeric_limits<int32_t>::max(), [&](std::span<const int32_t>) {
+    solutionsCount++;
+    return solutionsCount < maximumSolutionsCount;
+  });
+  return solutionsCount;
+}
+
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+std::optional<XccSolution>
+AlgorithmC::BasicSolver<BranchingPolicy, Index>::findOneSolution(const std::optional<int32_t>& seed) {
+  std::optional<XccSolution> solution;
+  visitSolutions(seed, forcedNodes, [&](std::span<const int32_t> optionIndices) {
+    solution.emplace(optionIndices);
+    // A single solution suffices
+    return false;
+  });
+  return solution;
+}
+
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+std::optional<XccSolution>
+AlgorithmC::BasicSolver<BranchingPolicy, Index>::findOneSolutionWithRestarts(const std::optional<int32_t>& seed,
+                                                                             const RestartStrategy& restartStrategy) {
+  // Every attempt is limited by the strategy and by what is left of the budget, which is restored at the end
+  const SearchBudget overallBudget = budget;
+  int64_t remainingNodesCount = overallBudget.maximumNodesCount.value_or(std::numeric_limits<int64_t>::max());
+  // The first attempt uses the given seed, such that a search that never restarts finds what findOneSolution() does.
+  // The seeds of the following attempts are drawn from it, such that the whole sequence of attempts is reproducible.
+  RandomGenerator seedGenerator(seed);
+  std::optional<XccSolution> solution;
+  for (int32_t attemptIndex = 0;; attemptIndex++) {
+    const int64_t attemptNodesCount = attemptNodesLimit(restartStrategy, attemptIndex);
+    const bool isLastAttempt = attemptNodesCount >= remainingNodesCount;
+    budget.maximumNodesCount = std::min(attemptNodesCount, remainingNodesCount);
+    const std::optional<int32_t> attemptSeed =
+        attemptIndex == 0 ? seed : seedGenerator.uniformInteger(0, std::numeric_limits<int32_t>::max());
+    solution = findOneSolution(attemptSeed);
+    // A search that is cut off counts one node past its limit
+    remainingNodesCount -= std::min(search.nodesCount, budget.maximumNodesCount.value());
+    // Restart only if the attempt ran out of its own nodes, not if the search tree was exhausted or the budget ran out
+    if (search.status != SearchStatus::CutOff || isLastAttempt || overallBudget.stopToken.stop_requested() ||
+        (overallBudget.deadline.has_value() && std::chrono::steady_clock::now() >= overallBudget.deadline.value())) {
+      break;
+    }
+  }
+  budget = overallBudget;
+  return solution;
+}
+
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+std::optional<XccSolution>
+AlgorithmC::BasicSolver<BranchingPolicy, Index>::hasUniqueSolution(const std::optional<int32_t>& seed) {
+  std::optional<XccSolution> solution;
+  int32_t solutionsCount = 0;
+  visitSolutions(seed, forcedNodes, [&](std::span<const int32_t> optionIndices) {
+    solutionsCount++;
+    if (solutionsCount == 1) {
+      solution.emplace(optionIndices);
+    }
+    // Exit early as soon as a second solution is found
+    return solutionsCount < 2;
+  });
+  if (solutionsCount != 1 || search.status == SearchStatus::CutOff) {
+    // Uniqueness cannot be proven when the search was cut off
     return {};
   }
   // There's only one solution
-  return *solutions.begin();
+  return solution;
+}
+
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+AlgorithmC::TreeSizeEstimate
+AlgorithmC::BasicSolver<BranchingPolicy, Index>::estimateTreeSize(int32_t samplesCount,
+                                                                  const std::optional<int32_t>& seed) {
+  if (samplesCount <= 0) {
+    throw std::runtime_error(std::string("The amount of samples of an estimate must be positive."));
+  }
+  TreeSizeEstimate estimate;
+  if (structure.optionsCount == 0) {
+    // Algorithm C doesn't run on an empty structure, its search tree has no nodes at all
+    estimate.samplesCount = samplesCount;
+    return estimate;
+  }
+
+  RandomGenerator pathGenerator(seed);
+  const int32_t branchingSeed = pathGenerator.uniformInteger(0, std::numeric_limits<int32_t>::max());
+  // Every path starts from the structure as it was loaded, with the forced options dictated at the first levels
+  begin(branchingSeed, forcedNodes, std::numeric_limits<int32_t>::max());
+  constexpr int32_t maxInt = std::numeric_limits<int32_t>::max();
+  const int32_t forcedLevels = static_cast<int32_t>(forcedNodes.size());
+  const int32_t second = search.second;
+
+  // The budget is checked every time a node of a path is entered, the deadline only periodically
+  constexpr int32_t nodesPerDeadlineCheck = 1024;
+  const int64_t maximumNodesCount = budget.maximumNodesCount.value_or(std::numeric_limits<int64_t>::max());
+  int32_t nodesUntilDeadlineCheck = 0;
+
+  double nodesCountDeviations = 0;
+  double solutionsCountSum = 0;
+  bool isCutOff = false;
+  while (estimate.samplesCount < samplesCount && !isCutOff) {
+    int32_t active = search.active;
+    // The amount of nodes on the current level that the node on the path stands for
+    double weight = 1;
+    double nodesCount = 0;
+    for (int32_t level = 0;; level++) {
+      search.nodesCount++;
+      if (search.nodesCount > maximumNodesCount || budget.stopToken.stop_requested()) {
+        isCutOff = true;
+        break;
+      }
+      if (budget.deadline.has_value() && --nodesUntilDeadlineCheck <= 0) {
+        nodesUntilDeadlineCheck = nodesPerDeadlineCheck;
+        if (std::chrono::steady_clock::now() >= budget.deadline.value()) {
+          isCutOff = true;
+          break;
+        }
+      }
+      nodesCount += weight;
+
+      int32_t itemIndex = 0;
+      int32_t itemSize = maxInt;
+      if (level < forcedLevels) {
+        // Only the forced option is tried at its level, unless one chosen above removed it
+        itemIndex = structure.NODE[forcedNodes[level]].item;
+        if (structure.position(itemIndex) >= active ||
+            structure.NODE[forcedNodes[level]].location >= itemIndex + structure.size(itemIndex)) {
+          break;
+        }
+        itemSize = 1;
+      } else {
+        branching.pickItem(structure, active, second, itemSize, itemIndex, searchStatistics);
+      }
+      if (itemSize == maxInt) {
+        // No item is left to cover, the node is a solution
+        solutionsCountSum += weight;
+        break;
+      }
+      if (itemSize == 0) {
+        break;
+      }
+
+      // Choose one of the options of the item uniformly, the node then stands for all of them
+      coverItem(itemIndex, active, second);
+      const int32_t location = level < forcedLevels ? structure.NODE[forcedNodes[level]].location
+                                                    : itemIndex + pathGenerator.uniformInteger(0, itemSize - 1);
+      weight *= static_cast<double>(itemSize);
+      if (!tryOption(structure.SET[location], active, second)) {
+        // Algorithm C doesn't enter the child, so the path ends here
+        break;
+      }
+    }
+    // Backtrack to the root, which leaves the structure ready for the next path
+    undoChanges(0, structure.itemsCount, active, second);
+
+    if (!isCutOff) {
+      // Welford's update of the mean and of the sum of the squared deviations from it
+      estimate.samplesCount++;
+      const double deviation = nodesCount - estimate.nodesCount;
+      estimate.nodesCount += deviation / estimate.samplesCount;
+      nodesCountDeviations += deviation * (nodesCount - estimate.nodesCount);
+    }
+  }
+  search.phase = SearchPhase::Finished;
+  search.status = isCutOff ? SearchStatus::CutOff : SearchStatus::Exhausted;
+
+  if (estimate.samplesCount > 0) {
+    estimate.solutionsCount = solutionsCountSum / estimate.samplesCount;
+  }
+  if (estimate.samplesCount > 1) {
+    estimate.nodesCountVariance = nodesCountDeviations / (estimate.samplesCount - 1);
+  }
+  return estimate;
+}
+
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+void AlgorithmC::BasicSolver<BranchingPolicy, Index>::setBudget(const SearchBudget& searchBudget) {
+  budget = searchBudget;
+}
+
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+void AlgorithmC::BasicSolver<BranchingPolicy, Index>::forceOptions(std::span<const int32_t> optionIndicesToForce) {
+  if (optionNodes.empty() && !optionIndicesToForce.empty()) {
+    // Walk the options of the structure as it was loaded: the spacer before every option holds its amount of nodes
+    const int32_t second = structure.secondaryItemsCount <= 0 ? std::numeric_limits<int32_t>::max()
+                                                              : initialItem.at(structure.primaryItemsCount);
+    optionNodes.assign(structure.optionsCount, -1);
+    int32_t spacerIndex = 0;
+    for (int32_t optionIndex = 0; optionIndex < structure.optionsCount; optionIndex++) {
+      const int32_t nodesCount = initialNode[spacerIndex].location;
+      for (int32_t nodeIndex = spacerIndex + 1; nodeIndex <= spacerIndex + nodesCount; nodeIndex++) {
+        if (initialNode[nodeIndex].item < second) {
+          optionNodes[optionIndex] = nodeIndex;
+          break;
+        }
+      }
+      spacerIndex += nodesCount + 1;
+    }
+  }
+
+  forcedNodes.clear();
+  for (const auto optionIndex : optionIndicesToForce) {
+    if (optionIndex < 0 || optionIndex >= structure.optionsCount) {
+      throw std::runtime_error(std::string("Invalid option index"));
+    }
+    if (optionNodes[optionIndex] < 0) {
+      throw std::runtime_error(std::string("An option without primary items cannot be forced"));
+    }
+    forcedNodes.push_back(optionNodes[optionIndex]);
+  }
+}
+
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+AlgorithmC::SearchStatus AlgorithmC::BasicSolver<BranchingPolicy, Index>::status() const {
+  return search.status;
+}
+
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+const AlgorithmC::SearchStatistics& AlgorithmC::BasicSolver<BranchingPolicy, Index>::statistics() const {
+  return searchStatistics;
+}
+
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+void AlgorithmC::BasicSolver<BranchingPolicy, Index>::startSearch(const std::optional<int32_t>& seed) {
+  begin(seed, forcedNodes, std::numeric_limits<int32_t>::max());
+}
+
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy, std::signed_integral Index>
+std::optional<std::span<const int32_t>> AlgorithmC::BasicSolver<BranchingPolicy, Index>::nextSolution() {
+  std::optional<std::span<const int32_t>> solution;
+  resume([&](std::span<const int32_t> nodeIndices) {
+    solution = toOptionIndices(nodeIndices);
+    // Pause right after this solution
+    return false;
+  });
+  return solution;
+}
+
+template class AlgorithmC::BasicSolver<AlgorithmC::FirstMrvPolicy>;
+template class AlgorithmC::BasicSolver<AlgorithmC::RandomMrvPolicy>;
+template class AlgorithmC::BasicSolver<AlgorithmC::ReservoirMrvPolicy>;
+template class AlgorithmC::BasicSolver<AlgorithmC::PreferredItemsMrvPolicy>;
+template class AlgorithmC::BasicSolver<AlgorithmC::BucketMrvPolicy>;
+template class AlgorithmC::BasicSolver<AlgorithmC::SizeTableMrvPolicy>;
+template class AlgorithmC::BasicSolver<AlgorithmC::FirstMrvPolicy, int16_t>;
+template class AlgorithmC::BasicSolver<AlgorithmC::RandomMrvPolicy, int16_t>;
+template class AlgorithmC::BasicSolver<AlgorithmC::ReservoirMrvPolicy, int16_t>;
+template class AlgorithmC::BasicSolver<AlgorithmC::PreferredItemsMrvPolicy, int16_t>;
+template class AlgorithmC::BasicSolver<AlgorithmC::BucketMrvPolicy, int16_t>;
+template class AlgorithmC::BasicSolver<AlgorithmC::SizeTableMrvPolicy, int16_t>;
+
+namespace {
+
+/** Runs tasks on a pool of workers, each of which loads the problem on its own solver once and reuses it for every task
+ * that it runs.
+ * @tparam Solver The type of the solvers, the one that withFittingSolver() picks for the problem.
+ * @param dataStructure The data structure representing XCC problem.
+ * @param tasksCount The amount of tasks, they are identified by the indices [0, tasksCount).
+ * @param workersCount The amount of worker threads to use.
+ * @param budget The budget of every search of the solvers.
+ * @param task Called with the solver of the worker and the index of the task.
+ */
+template <typename Solver, typename Task>
+void runWithWorkerSolvers(const DancingCellsStructure& dataStructure,
+                          std::size_t tasksCount,
+                          int32_t workersCount,
+                          const AlgorithmC::SearchBudget& budget,
+                          Task&& task) {
+  // Every worker copies the structure into its solver when it starts its first task, such that copies are made in
+  // parallel, and workers that never get a task don't make any
+  std::vector<std::optional<Solver>> solvers(workersCount);
+  WorkStealing::run(tasksCount, workersCount, [&](std::size_t taskIndex, std::size_t workerIndex) {
+    auto& solver = solvers[workerIndex];
+    if (!solver.has_value()) {
+      solver.emplace(dataStructure);
+      solver->setBudget(budget);
+    }
+    task(solver.value(), taskIndex);
+  });
+}
+
+/** Draws the seeds of the independent searches that a parallel search is made of, such that its result doesn't depend
+ * on which worker runs which search.
+ * @param seed The seed from which the seeds are drawn. Uses a random seed if not available.
+ * @param seedsCount The amount of seeds.
+ * @return The seeds.
+ */
+std::vector<int32_t> drawSeeds(const std::optional<int32_t>& seed, std::size_t seedsCount) {
+  RandomGenerator seedGenerator(seed);
+  std::vector<int32_t> seeds;
+  seeds.reserve(seedsCount);
+  for (std::size_t i = 0; i < seedsCount; i++) {
+    seeds.push_back(
+        seedGenerator.uniformInteger(std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max()));
+  }
+  return seeds;
+}
+
+} // namespace
+
+int64_t AlgorithmC::attemptNodesLimit(const RestartStrategy& restartStrategy, int32_t attemptIndex) {
+  if (restartStrategy.baseNodesCount <= 0) {
+    throw std::runtime_error(std::string("The base amount of nodes of a restart strategy must be positive."));
+  }
+  constexpr int64_t maxNodesCount = std::numeric_limits<int64_t>::max();
+  if (restartStrategy.schedule == RestartSchedule::Geometric) {
+    if (restartStrategy.growthFactor < 1.0) {
+      throw std::runtime_error(std::string("The growth factor of a restart strategy cannot be smaller than one."));
+    }
+    const double limit = static_cast<double>(restartStrategy.baseNodesCount) *
+                         std::pow(restartStrategy.growthFactor, static_cast<double>(attemptIndex));
+    return limit >= static_cast<double>(maxNodesCount) ? maxNodesCount : static_cast<int64_t>(limit);
+  }
+
+  // The first 2^k - 1 terms of the Luby sequence are two copies of its first 2^(k-1) - 1 terms, followed by 2^(k-1).
+  // Find the smallest such prefix that contains the attempt, then descend into the copies of the shorter prefix until
+  // the attempt is at the end of one.
+  int64_t index = attemptIndex;
+  int64_t size = 1;
+  int32_t exponent = 0;
+  while (size < index + 1) {
+    size = 2 * size + 1;
+    exponent++;
+  }
+  while (size - 1 != index) {
+    size = (size - 1) / 2;
+    exponent--;
+    index %= size;
+  }
+  const int64_t term = int64_t{1} << exponent;
+  return term > maxNodesCount / restartStrategy.baseNodesCount ? maxNodesCount : term * restartStrategy.baseNodesCount;
+}
+
+std::vector<XccSolution> AlgorithmC::findAllSolutions(const DancingCellsStructure& dataStructure,
+                                                      const std::optional<int32_t>& seed) {
+  return withFittingSolver(dataStructure, [&](auto& solver) { return solver.findAllSolutions(seed); });
+}
+
+std::vector<XccSolution> AlgorithmC::findAllSolutionsInParallel(const DancingCellsStructure& dataStructure,
+                                                                const std::optional<int32_t>& seed,
+                                                                const std::optional<int32_t>& threadsCount) {
+  const int32_t workersCount = WorkStealing::resolveThreadsCount(threadsCount);
+  if (workersCount == 1) {
+    return findAllSolutions(dataStructure, seed);
+  }
+
+  // Create enough subtrees such that workers that finish early can steal the remaining ones
+  constexpr std::size_t subtreesPerWorker = 16;
+  constexpr int32_t maximumSplitLevel = 8;
+  return withFittingSolver(dataStructure, [&]<typename Solver>(Solver& solver) {
+    const auto subtrees = solver.splitSearchTree(seed, subtreesPerWorker * workersCount, maximumSplitLevel);
+
+    // Every subtree gets its own seed, such that the solutions are reproducible regardless of which worker explores it
+    const auto subtreeSeeds = drawSeeds(seed, subtrees.size());
+
+    // Each worker explores its subtrees on its own copy of the structure
+    std::vector<std::vector<XccSolution>> subtreeSolutions(subtrees.size());
+    runWithWorkerSolvers<Solver>(
+        dataStructure, subtrees.size(), workersCount, {}, [&](Solver& workerSolver, std::size_t subtreeIndex) {
+          subtreeSolutions[subtreeIndex] =
+              workerSolver.collectSolutions(subtreeSeeds[subtreeIndex], subtrees[subtreeIndex]);
+        });
+
+    // Gather the solutions in the order of the subtrees
+    std::vector<XccSolution> solutions;
+    for (auto& solutionsOfSubtree : subtreeSolutions) {
+      std::ranges::move(solutionsOfSubtree, std::back_inserter(solutions));
+    }
+    return solutions;
+  });
+}
+
+int64_t AlgorithmC::countSolutions(const DancingCellsStructure& dataStructure,
+                                   const std::optional<int32_t>& seed,
+                                   const std::optional<int64_t>& limit) {
+  return withFittingSolver(dataStructure, [&](auto& solver) { return solver.countSolutions(seed, limit); });
+}
+
+AlgorithmC::SearchStatus AlgorithmC::forEachSolution(const DancingCellsStructure& dataStructure,
+                                                     const std::optional<int32_t>& seed,
+                                                     const SolutionVisitor& visitor) {
+  return withFittingSolver(dataStructure, [&](auto& solver) { return solver.forEachSolution(seed, visitor); });
+}
+
+std::optional<XccSolution> AlgorithmC::findOneSolution(const DancingCellsStructure& dataStructure,
+                                                       const std::optional<int32_t>& seed) {
+  return withFittingSolver(dataStructure, [&](auto& solver) { return solver.findOneSolution(seed); });
+}
+
+std::optional<XccSolution> AlgorithmC::findOneSolutionWithRestarts(const DancingCellsStructure& dataStructure,
+                                                                   const std::optional<int32_t>& seed,
+                                                                   const RestartStrategy& restartStrategy) {
+  return withFittingSolver(dataStructure,
+                           [&](auto& solver) { return solver.findOneSolutionWithRestarts(seed, restartStrategy); });
+}
+
+AlgorithmC::PortfolioSolution AlgorithmC::findOneSolutionWithPortfolio(const DancingCellsStructure& dataStructure,
+                                                                       const std::optional<int32_t>& seed,
+                                                                       int32_t searchesCount,
+                                                                       const std::optional<int32_t>& threadsCount) {
+  if (searchesCount <= 0) {
+    throw std::runtime_error(std::string("A portfolio needs at least one search."));
+  }
+  const int32_t workersCount = std::min(WorkStealing::resolveThreadsCount(threadsCount), searchesCount);
+  const auto searchSeeds = drawSeeds(seed, searchesCount);
+
+  // The first search that completes, with or without a solution, settles the result and cancels the others
+  std::mutex resultMutex;
+  std::stop_source stopSource;
+  PortfolioSolution result;
+  WorkStealing::run(searchesCount, workersCount, [&](std::size_t searchIndex) {
+    if (stopSource.stop_requested()) {
+      return;
+    }
+    withFittingSolver(dataStructure, [&](auto& solver) {
+      solver.setBudget({.stopToken = stopSource.get_token()});
+      auto solution = solver.findOneSolution(searchSeeds[searchIndex]);
+      if (solver.status() == SearchStatus::CutOff) {
+        return;
+      }
+      const std::lock_guard lock(resultMutex);
+      if (!stopSource.stop_requested()) {
+        stopSource.request_stop();
+        if (solution.has_value()) {
+          result = {std::move(solution), searchSeeds[searchIndex]};
+        }
+      }
+    });
+  });
+  return result;
+}
+
+AlgorithmC::TreeSizeEstimate AlgorithmC::estimateTreeSize(const DancingCellsStructure& dataStructure,
+                                                          int32_t samplesCount,
+                                                          const std::optional<int32_t>& seed) {
+  return withFittingSolver(dataStructure, [&](auto& solver) { return solver.estimateTreeSize(samplesCount, seed); });
+}
+
+std::optional<XccSolution> AlgorithmC::hasUniqueSolution(const DancingCellsStructure& dataStructure,
+                                                         const std::optional<int32_t>& seed) {
+  return withFittingSolver(dataStructure, [&](auto& solver) { return solver.hasUniqueSolution(seed); });
+}
+
+std::optional<XccSolution> AlgorithmC::hasUniqueSolutionInParallel(const DancingCellsStructure& dataStructure,
+                                                                   const std::optional<int32_t>& seed,
+                                                                   const std::optional<int32_t>& threadsCount) {
+  const int32_t workersCount = WorkStealing::resolveThreadsCount(threadsCount);
+  if (workersCount == 1) {
+    return hasUniqueSolution(dataStructure, seed);
+  }
+
+  // Split the tree like findAllSolutionsInParallel(), a unique solution has to be proven by exploring all of it
+  constexpr std::size_t subtreesPerWorker = 16;
+  constexpr int32_t maximumSplitLevel = 8;
+  return withFittingSolver(dataStructure, [&]<typename Solver>(Solver& solver) -> std::optional<XccSolution> {
+    const auto subtrees = solver.splitSearchTree(seed, subtreesPerWorker * workersCount, maximumSplitLevel);
+    const auto subtreeSeeds = drawSeeds(seed, subtrees.size());
+
+    // Only the worker that finds the first solution stores it, and whoever finds the second one stops every worker
+    std::atomic<int32_t> solutionsCount = 0;
+    std::stop_source stopSource;
+    std::optional<XccSolution> solution;
+    // Each worker explores its subtrees on its own copy of the structure, whose searches are cut off by the stop
+    const SearchBudget budget = {.stopToken = stopSource.get_token()};
+    const auto exploreSubtree = [&](Solver& workerSolver, std::size_t subtreeIndex) {
+      if (stopSource.stop_requested()) {
+        return;
+      }
+      workerSolver.visitSolutions(
+          subtreeSeeds[subtreeIndex], subtrees[subtreeIndex], [&](std::span<const int32_t> optionIndices) {
+            const int32_t count = ++solutionsCount;
+            if (count == 1) {
+              solution.emplace(optionIndices);
+              return true;
+            }
+            stopSource.request_stop();
+            return false;
+          });
+    };
+    runWithWorkerSolvers<Solver>(dataStructure, subtrees.size(), workersCount, budget, exploreSubtree);
+
+    if (solutionsCount != 1) {
+      return {};
+    }
+    return solution;
+  });
 }
@@ -1,33 +1,516 @@
 #pragma once
 
+#include "BranchingPolicies.hpp"
 #include "DancingCellsStructure.hpp"
+#include "SearchStatistics.hpp"
+#include "XccSolution.hpp"
 
+#include <chrono>
+#include <concepts>
 #include <cstdint>
+#include <functional>
 #include <optional>
-#include <unordered_set>
+#include <span>
+#include <stop_token>
+#include <utility>
+#include <vector>
 
 /** Namespace that interfaces with Algorithm C, a recursive, nondeterministic, depth-first, backtracking algorithm.
  * It is used to find solutions of "Exact Covering with Colors" (XCC) problems.
  */
 namespace AlgorithmC {
 
+/** How a search through the solutions of an XCC problem ended.
+ */
+enum class SearchStatus {
+  /// The whole search tree was explored
+  Exhausted,
+  /// The search was stopped before exploring the whole search tree
+  Stopped,
+  /// The search ran out of budget before exploring the whole search tree
+  CutOff,
+};
+
+/** Limits on how much work a single search may do. A search that exceeds any of them is cut off.
+ */
+struct SearchBudget {
+  /// The maximum amount of nodes of the search tree to visit. Unlimited if not available.
+  std::optional<int64_t> maximumNodesCount = std::nullopt;
+  /// The moment after which the search is cut off. It is only checked periodically, so a search may overrun it by a
+  /// few nodes. Unlimited if not available.
+  std::optional<std::chrono::steady_clock::time_point> deadline = std::nullopt;
+  /// Cuts the search off as soon as a stop is requested on it
+  std::stop_token stopToken = {};
+};
+
+/** How the amount of nodes that consecutive attempts of a search with restarts may visit grows.
+ */
+enum class RestartSchedule {
+  /// The base amount of nodes times the terms of the Luby sequence 1, 1, 2, 1, 1, 2, 4, 1, 1, 2, ... It is within a
+  /// logarithmic factor of the best fixed limit, without knowing anything about the distribution of running times.
+  Luby,
+  /// The base amount of nodes times the growth factor to the power of the attempt index
+  Geometric,
+};
+
+/** When a search for a single solution is abandoned and started over with another seed.
+ */
+struct RestartStrategy {
+  /// How the limits of consecutive attempts grow
+  RestartSchedule schedule = RestartSchedule::Luby;
+  /// The amount of nodes that the first attempt may visit
+  int64_t baseNodesCount = 1000;
+  /// By how much the limit grows from one attempt to the next, only used by the geometric schedule
+  double growthFactor = 2.0;
+};
+
+/** Computes the maximum amount of nodes of the search tree that an attempt of a search with restarts may visit.
+ * @param restartStrategy The strategy of the search.
+ * @param attemptIndex The index of the attempt, starting at zero.
+ * @return The maximum amount of nodes, saturated at the largest representable amount.
+ */
+int64_t attemptNodesLimit(const RestartStrategy& restartStrategy, int32_t attemptIndex);
+
+/** The outcome of a portfolio of searches for a single solution, see findOneSolutionWithPortfolio().
+ */
+struct PortfolioSolution {
+  /// The solution found first. Empty if the problem has no solutions.
+  std::optional<XccSolution> solution;
+  /// The seed of the search that found the solution, with which findOneSolution() finds it again on its own. Empty if
+  /// no solution was found.
+  std::optional<int32_t> winningSeed;
+};
+
+/** An estimate of the size of the search tree of a problem, see BasicSolver::estimateTreeSize().
+ */
+struct TreeSizeEstimate {
+  /// The estimated amount of nodes of the search tree, the mean of the estimates of all samples
+  double nodesCount = 0;
+  /// The sample variance of the estimates of the nodes. The variance of nodesCount is this divided by samplesCount.
+  double nodesCountVariance = 0;
+  /// The estimated amount of solutions, the mean of the estimates of all samples
+  double solutionsCount = 0;
+  /// The amount of random paths that the estimate is made of
+  int32_t samplesCount = 0;
+};
+
+/** Function called for every solution found. It receives the indices of the options that make up the solution, which
+ * are only valid for the duration of the call. Returns whether the search should continue.
+ */
+using SolutionVisitor = std::function<bool(std::span<const int32_t>)>;
+
+/** Solver for XCC problems that owns the memory that Algorithm C works on.
+ * Algorithm C modifies the ITEM, SET and NODE lists of the structure while it runs. The solver keeps a copy of them as
+ * they were loaded, and restores them in place before every search. The choices made on each level and the stack of
+ * saved sizes are kept between searches as well. Solving the same problem multiple times, or loading problems of the
+ * same shape, therefore does not allocate any memory after the first search.
+ *
+ * Solutions can also be pulled one at a time with startSearch() and nextSolution(). The state of the search is kept in
+ * the solver between calls, so several solvers can be interleaved on the same thread. Every other search method starts
+ * a new search, which discards the one in progress.
+ *
+ * The copy that Algorithm C works on stores its indices as Index. Narrower indices make the lists that every hide()
+ * walks through smaller, such that more of them stay in the caches. Solutions and search trees don't depend on it.
+ * @tparam BranchingPolicy Decides on which item to branch at every level of the search, see BranchingPolicyConcept.
+ * @tparam Index The integer type of the indices of the copy of the structure, see BasicDancingCellsStructure.
+ */
+template <BranchingPolicyConcept BranchingPolicy, std::signed_integral Index = int32_t>
+class BasicSolver {
+public:
+  /** Constructor
+   * @param dataStructure The data structure representing XCC problem. The solver works on its own copy, which throws
+   * if the problem does not fit in the index type.
+   * @param branchingPolicy The policy that picks the items to branch on.
+   */
+  explicit BasicSolver(const DancingCellsStructure& dataStructure, BranchingPolicy branchingPolicy = {});
+
+  /** Replaces the problem being solved, reusing the memory of the previous one wherever it is large enough.
+   * @param dataStructure The data structure representing XCC problem. The solver works on its own copy, which throws
+   * if the problem does not fit in the index type.
+   */
+  void load(const DancingCellsStructure& dataStructure);
+
+  /** Passes every solution of the loaded problem to the visitor as soon as it is found.
+   * @param seed The seed for the random number generator. Uses a random seed if not available.
+   * @param visitor Called with the option indices of every solution, in the order that they are found. The search
+   * stops as soon as it returns false.
+   * @return Whether all solutions were visited, the visitor stopped the search, or the search ran out of budget.
+   */
+  SearchStatus forEachSolution(const std::optional<int32_t>& seed, const SolutionVisitor& visitor);
+
+  /** Retrieves all solutions of the loaded problem.
+   * @param seed The seed for the random number generator. Uses a random seed if not available.
+   * @return The solutions, in the order that they are found.
+   */
+  std::vector<XccSolution> findAllSolutions(const std::optional<int32_t>& seed);
+
+  /** Counts the solutions of the loaded problem, without storing any of them.
+   * @param seed The seed for the random number generator. Uses a random seed if not available.
+   * @param limit The amount of solutions after which counting stops early. Counts all solutions if not available.
+   * @return The amount of solutions, which is at most the limit.
+   */
+  int64_t countSolutions(const std::optional<int32_t>& seed, const std::optional<int64_t>& limit);
+
+  /** Retrieves the first solution found of the loaded problem.
+   * @param seed The seed for the random number generator. Uses a random seed if not available.
+   * @return If there's at least one, a solution of the XCC problem. Returns an empty optional otherwise.
+   */
+  std::optional<XccSolution> findOneSolution(const std::optional<int32_t>& seed);
+
+  /** Retrieves the first solution found of the loaded problem, restarting the search from scratch with another seed
+   * whenever an attempt visits more nodes than the restart strategy allows. With random tie-breaking, this cuts the
+   * heavy tail of running times caused by an unlucky choice near the root. An attempt that explores its whole search
+   * tree proves that there's no solution. The budget limits all attempts together, and statistics() describes the last
+   * one.
+   * @param seed The seed of the first attempt, from which the seeds of the others are drawn. Uses a random seed if not
+   * available.
+   * @param restartStrategy The limits of the attempts.
+   * @return If there's at least one, a solution of the XCC problem. Returns an empty optional otherwise, or if the
+   * search ran out of budget.
+   */
+  std::optional<XccSolution> findOneSolutionWithRestarts(const std::optional<int32_t>& seed,
+                                                         const RestartStrategy& restartStrategy);
+
+  /** Computes whether the loaded problem has exactly one solution, stopping as soon as a second one is found.
+   * @param seed The seed for the random number generator. Uses a random seed if not available.
+   * @return If exactly one solution exists, then that solution. Otherwise an empty optional.
+   */
+  std::optional<XccSolution> hasUniqueSolution(const std::optional<int32_t>& seed);
+
+  /** Estimates the size of the search tree of the loaded problem without exploring it, with Knuth's estimator. Every
+   * sample walks a random path down from the root. On every level it draws one of the options of the item that the
+   * branching policy picks uniformly, and the node that it reaches stands for the product of the sizes of the items
+   * above it. When Algorithm C would not enter the drawn child, because the option leaves an item without options, the
+   * path ends there and the child adds nothing. That keeps the sum of the products on a path an unbiased estimate of
+   * the amount of nodes that a search enters.
+   *
+   * A path is walked once, covering and uncovering like the search itself, so a sample costs about as much as the
+   * branch of a search down to the same depth, and nothing in the size of the tree. Forced options are chosen at the
+   * first levels like in every search. The budget counts the nodes of all paths, an estimation that is cut off is made
+   * of the paths completed until then.
+   * @param samplesCount The amount of random paths, which must be positive.
+   * @param seed The seed of the random paths and of the tie-breaking of the branching policy. Uses a random seed if not
+   * available.
+   * @return The estimate.
+   */
+  TreeSizeEstimate estimateTreeSize(int32_t samplesCount, const std::optional<int32_t>& seed);
+
+  /** Limits the work that every following search may do. Searches that run out of budget are cut off, the methods
+   * then return what was found up to that point, and status() reports it. A cut off search never proves uniqueness.
+   * @param searchBudget The budget for every following search.
+   */
+  void setBudget(const SearchBudget& searchBudget);
+
+  /** Forces options into every following search, as if they were chosen at its first levels. Only the solutions that
+   * contain all of them are found, such that a problem with some of its options given is solved without loading
+   * another structure. Loading a problem releases them.
+   * @param optionIndices The indices of the options, each of which must contain a primary item. Options that conflict
+   * with each other leave no solutions.
+   */
+  void forceOptions(std::span<const int32_t> optionIndices);
+
+  /** How the last search ended, or how far it got if it is still in progress.
+   * @return The status of the last search.
+   */
+  SearchStatus status() const;
+
+  /** The statistics of the last search, or of how far it got if it is still in progress.
+   * Only recorded if areStatisticsEnabled, otherwise every counter is zero.
+   * @return The statistics of the last search.
+   */
+  const SearchStatistics& statistics() const;
+
+  /** Starts a new search through the solutions of the loaded problem, which are then retrieved with nextSolution().
+   * @param seed The seed for the random number generator. Uses a random seed if not available.
+   */
+  void startSearch(const std::optional<int32_t>& seed);
+
+  /** Continues the search started by startSearch() until the next solution is found.
+   * @return The option indices of the next solution, which are only valid until the solver is used again. Returns an
+   * empty optional once all solutions have been retrieved, or if no search was started.
+   */
+  std::optional<std::span<const int32_t>> nextSolution();
+
+private:
+  friend std::vector<XccSolution> findAllSolutionsInParallel(const DancingCellsStructure& dataStructure,
+                                                             const std::optional<int32_t>& seed,
+                                                             const std::optional<int32_t>& threadsCount);
+  friend std::optional<XccSolution> hasUniqueSolutionInParallel(const DancingCellsStructure& dataStructure,
+                                                                const std::optional<int32_t>& seed,
+                                                                const std::optional<int32_t>& threadsCount);
+
+  /** Restores the ITEM, SET and NODE lists to how they were when the problem was loaded.
+   */
+  void restore();
+
+  /** Prepares a new search on the structure as it was loaded. The search is run by calling resume().
+   * @param seed The seed for the random number generator. Uses a random seed if not available.
+   * @param prefix The nodes of the options that are chosen at the first levels of the search, one for each level. Only
+   * the subtree below these choices is explored. When empty, the whole search tree is explored.
+   * @param cutoffLevel The level at which the search stops descending, and reports the choices made so far instead.
+   */
+  void begin(const std::optional<int32_t>& seed, std::span<const int32_t> prefix, int32_t cutoffLevel);
+
+  /** Runs Algorithm C from where the search was left, and reports every leaf of the search tree that it reaches.
+   * A leaf is either a solution, or a partial solution that has reached the cutoff level. When the visitor returns
+   * false the search is paused, and the next call continues right after the leaf that was reported last.
+   * @param visitor Called with the first nodes of the options chosen so far whenever a leaf is reached. Returns
+   * whether the search should continue.
+   */
+  template <typename Visitor>
+  void resume(Visitor&& visitor);
+
+  /** Covers an item to branch on: makes it inactive and hides the options that conflict with it.
+   * @param itemIndex The item to cover.
+   * @param active The amount of active items, which becomes one less.
+   * @param second The smallest secondary item.
+   */
+  void coverItem(int32_t itemIndex, int32_t& active, int32_t second);
+
+  /** Chooses an option of the item that was covered last, by covering the other items of that option.
+   * @param currentNodeIndex The node of the option in the list of the covered item.
+   * @param active The amount of active items, which shrinks by the items of the option.
+   * @param second The smallest secondary item.
+   * @return Whether the option leaves every active primary item with an option. If not, the changes made so far must
+   * be undone before anything else is tried.
+   */
+  bool tryOption(int32_t currentNodeIndex, int32_t& active, int32_t second);
+
+  /** Backtracks: restores the sizes saved since a point of the search, and the items that were active then.
+   * @param savedIndex The size of the stack of saved sizes at that point.
+   * @param savedActiveCount The amount of active items at that point.
+   * @param active The amount of active items, which becomes savedActiveCount.
+   * @param second The smallest secondary item.
+   */
+  void undoChanges(int32_t savedIndex, int32_t savedActiveCount, int32_t& active, int32_t second);
+
+  /** Starts a new search, see begin(), and runs it until the visitor stops it or the search tree is exhausted.
+   * @param seed The seed for the random number generator. Uses a random seed if not available.
+   * @param prefix The nodes of the options that are chosen at the first levels of the search, one for each level. Only
+   * the subtree below these choices is explored. When empty, the whole search tree is explored.
+   * @param cutoffLevel The level at which the search stops descending, and reports the choices made so far instead.
+   * @param visitor Called with the first nodes of the options chosen so far whenever a leaf is reached. Returns
+   * whether the search should continue.
+   */
+  template <typename Visitor>
+  void run(const std::optional<int32_t>& seed, std::span<const int32_t> prefix, int32_t cutoffLevel, Visitor&& visitor);
+
+  /** Translates the nodes of the options of a solution into the indices of those options.
+   * @param nodeIndices The nodes of the options chosen at every level.
+   * @return The option indices, which are only valid until the next solution is translated.
+   */
+  std::span<const int32_t> toOptionIndices(std::span<const int32_t> nodeIndices);
+
+  /** Runs Algorithm C and reports the option indices of every solution that it finds.
+   * @param seed The seed for the random number generator. Uses a random seed if not available.
+   * @param prefix The nodes of the options chosen at the first levels, only the subtree below them is explored.
+   * @param visitor Called with the option indices of every solution found. Returns whether the search should continue.
+   * @return Whether the search explored the whole (sub)tree, was stopped by the visitor, or ran out of budget.
+   */
+  template <typename Visitor>
+  SearchStatus visitSolutions(const std::optional<int32_t>& seed, std::span<const int32_t> prefix, Visitor&& visitor);
+
+  /** Runs Algorithm C and collects all the solutions it finds.
+   * @param seed The seed for the random number generator. Uses a random seed if not available.
+   * @param prefix The nodes of the options chosen at the first levels, only the subtree below them is explored.
+   * @return The solutions, in the order that they are found.
+   */
+  std::vector<XccSolution> collectSolutions(const std::optional<int32_t>& seed, std::span<const int32_t> prefix);
+
+  /** Splits the search tree into independent subtrees, by branching on the first levels of the search.
+   * Each subtree is identified by the nodes of the options chosen on the levels above it. Subtrees that are solutions
+   * themselves are kept as they are, subtrees that cannot lead to a solution are discarded.
+   * @param seed The seed for the random number generator. Uses a random seed if not available.
+   * @param minimumSubtreesCount The amount of subtrees after which splitting stops
+   * @param maximumLevel The deepest level at which the tree is split
+   * @return The subtrees, in the order that a sequential search would visit them.
+   */
+  std::vector<std::vector<int32_t>>
+      splitSearchTree(const std::optional<int32_t>& seed, std::size_t minimumSubtreesCount, int32_t maximumLevel);
+
+  /// The structure that Algorithm C modifies while searching
+  BasicDancingCellsStructure<Index> structure;
+  /// The ITEM list of the structure as it was loaded
+  std::vector<Index> initialItem;
+  /// The SET list of the structure as it was loaded
+  std::vector<Index> initialSet;
+  /// The NODE list of the structure as it was loaded
+  std::vector<BasicDancingCellsNode<Index>> initialNode;
+  /// Whether a search has modified the structure since it was loaded
+  bool isModified = false;
+  /// The node chosen on each level
+  std::vector<int32_t> choices;
+  /// The size of saveStack on each level
+  std::vector<int32_t> saved;
+  /// The amount of active items on each level
+  std::vector<int32_t> savedActive;
+  /// The items whose size changed, together with their size before the change, to restore them when backtracking
+  std::vector<std::pair<Index, Index>> saveStack;
+  /// Buffer in which the option indices of a solution are reported
+  std::vector<int32_t> optionIndices;
+  /// The node of a primary item of every option, only computed once options are forced
+  std::vector<int32_t> optionNodes;
+  /// The nodes of the forced options, chosen at the first levels of every search
+  std::vector<int32_t> forcedNodes;
+
+  /** How far along a search is.
+   */
+  enum class SearchPhase {
+    /// The search has been prepared, but it has not reached any leaf yet
+    Started,
+    /// The search reported a leaf and continues from the next branch when resumed
+    Paused,
+    /// The whole search tree was explored, or there's no search
+    Finished,
+  };
+
+  /** The registers of Algorithm C that are kept between calls, such that a search can be paused and resumed.
+   * The other registers can be recomputed from these, the choices and the saveStack when backtracking.
+   */
+  struct SearchState {
+    /// How far along the search is
+    SearchPhase phase = SearchPhase::Finished;
+    /// The nodes of the options that are chosen at the first levels
+    std::span<const int32_t> prefix;
+    /// The level at which the search stops descending
+    int32_t cutoffLevel = 0;
+    /// The current level of the search
+    int32_t level = 0;
+    /// The amount of currently active items
+    int32_t active = 0;
+    /// The internal number of the smallest secondary item
+    int32_t second = 0;
+    /// The amount of nodes of the search tree visited so far
+    int64_t nodesCount = 0;
+    /// How the search ended, or how far it got so far
+    SearchStatus status = SearchStatus::Exhausted;
+  };
+
+  /// The limits of every search
+  SearchBudget budget;
+  /// The state of the current search
+  SearchState search;
+  /// The statistics of the current search
+  SearchStatistics searchStatistics;
+  /// Picks the item to branch on at every level, restarted at the start of every search
+  BranchingPolicy branching;
+};
+
+/// The solver that breaks ties between the items to branch on at random, as the functions below do
+using Solver = BasicSolver<RandomMrvPolicy>;
+
+/// The solver with random tie-breaking that works on 16 bit indices. The functions below use it whenever the problem
+/// fits in them, it finds the same solutions in the same order as Solver.
+using CompactSolver = BasicSolver<RandomMrvPolicy, int16_t>;
+
+/** Runs a function on the solver with the narrowest indices that the problem fits in, which is how the functions below
+ * pick between Solver and CompactSolver. Both find the same solutions in the same order, the compact one only does so
+ * with less memory.
+ * @param dataStructure The data structure representing XCC problem.
+ * @param function Called with the solver on which the problem is loaded.
+ * @return What the function returns.
+ */
+template <typename Function>
+auto withFittingSolver(const DancingCellsStructure& dataStructure, Function&& function) {
+  if (CompactDancingCellsStructure::fits(dataStructure)) {
+    CompactSolver solver(dataStructure);
+    return function(solver);
+  }
+  Solver solver(dataStructure);
+  return function(solver);
+}
+
 /** Solves the XCC problem described by the structure and retrieves all possible solutions.
  * @param dataStructure The data structure representing XCC problem.
  * @param seed The seed for the random number generator. Uses a random seed if not available.
- * @return Returns potentially zero, one or many sets of option indices that solve the XCC problem. The solutions
+ * @return Returns potentially zero, one or many solutions of the XCC problem. The solutions
  * retrieved are in the order that they are found.
  */
-std::vector<std::unordered_set<int32_t>> findAllSolutions(DancingCellsStructure& dataStructure,
-                                                          const std::optional<int32_t>& seed);
+std::vector<XccSolution> findAllSolutions(const DancingCellsStructure& dataStructure,
+                                          const std::optional<int32_t>& seed);
+
+/** Solves the XCC problem described by the structure and retrieves all possible solutions, using multiple threads.
+ * The search tree is split at its first levels into subtrees, which are explored by a pool of workers that steal
+ * subtrees from each other when idle. Every worker explores its subtrees on its own copy of the structure.
+ * @param dataStructure The data structure representing XCC problem.
+ * @param seed The seed for the random number generator. Uses a random seed if not available.
+ * @param threadsCount The amount of threads to use. Uses all available hardware threads if not available.
+ * @return Returns potentially zero, one or many solutions of the XCC problem. These are the same
+ * solutions that findAllSolutions() retrieves, grouped by the subtree in which they were found.
+ */
+std::vector<XccSolution> findAllSolutionsInParallel(const DancingCellsStructure& dataStructure,
+                                                    const std::optional<int32_t>& seed,
+                                                    const std::optional<int32_t>& threadsCount);
+
+/** Counts the solutions of the XCC problem described by the structure, without storing any of them.
+ * @param dataStructure The data structure representing XCC problem.
+ * @param seed The seed for the random number generator. Uses a random seed if not available.
+ * @param limit The amount of solutions after which counting stops early. Counts all solutions if not available.
+ * @return The amount of solutions, which is at most the limit.
+ */
+int64_t countSolutions(const DancingCellsStructure& dataStructure,
+                       const std::optional<int32_t>& seed,
+                       const std::optional<int64_t>& limit);
+
+/** Solves the XCC problem described by the structure, and passes every solution to the visitor as soon as it is found.
+ * Solutions are not stored, which allows streaming them somewhere else while the search runs.
+ * @param dataStructure The data structure representing XCC problem.
+ * @param seed The seed for the random number generator. Uses a random seed if not available.
+ * @param visitor Called with the option indices of every solution, in the order that they are found. The search stops
+ * as soon as it returns false.
+ * @return Whether all solutions were visited, or the visitor stopped the search.
+ */
+SearchStatus forEachSolution(const DancingCellsStructure& dataStructure,
+                             const std::optional<int32_t>& seed,
+                             const SolutionVisitor& visitor);
 
 /** Solves the XCC problem described by the structure and retrieves the first solution found.
  * @param dataStructure The data structure representing XCC problem.
  * @param seed The seed for the random number generator. Uses a random seed if not available.
- * @return If there's at least one, a set of option indices that solve the XCC problem. This solution is not guaranteed
+ * @return If there's at least one, a solution of the XCC problem. This solution is not guaranteed
  * to be unique. Returns an empty optional if there are no solutions.
  */
-std::optional<std::unordered_set<int32_t>> findOneSolution(DancingCellsStructure& dataStructure,
-                                                           const std::optional<int32_t>& seed);
+std::optional<XccSolution> findOneSolution(const DancingCellsStructure& dataStructure,
+                                           const std::optional<int32_t>& seed);
+
+/** Solves the XCC problem described by the structure and retrieves the first solution found, restarting the search
+ * with another seed whenever an attempt runs out of nodes, see BasicSolver::findOneSolutionWithRestarts().
+ * @param dataStructure The data structure representing XCC problem.
+ * @param seed The seed of the first attempt, from which the seeds of the others are drawn. Uses a random seed if not
+ * available.
+ * @param restartStrategy The limits of the attempts.
+ * @return If there's at least one, a solution of the XCC problem. Returns an empty optional if there are no solutions.
+ */
+std::optional<XccSolution> findOneSolutionWithRestarts(const DancingCellsStructure& dataStructure,
+                                                       const std::optional<int32_t>& seed,
+                                                       const RestartStrategy& restartStrategy);
+
+/** Solves the XCC problem described by the structure with a portfolio of searches for a single solution. Every search
+ * gets its own seed, which changes how ties between items are broken and therefore how long the search takes. The
+ * searches run on a pool of threads, and the first one that finds a solution, or proves that there is none, cancels
+ * all the others.
+ * @param dataStructure The data structure representing XCC problem.
+ * @param seed The seed from which the seeds of the searches are drawn. Uses a random seed if not available.
+ * @param searchesCount The amount of searches in the portfolio, which must be positive.
+ * @param threadsCount The amount of threads to use. Uses all available hardware threads if not available.
+ * @return The solution found first, along with the seed of the search that found it.
+ */
+PortfolioSolution findOneSolutionWithPortfolio(const DancingCellsStructure& dataStructure,
+                                               const std::optional<int32_t>& seed,
+                                               int32_t searchesCount,
+                                               const std::optional<int32_t>& threadsCount);
+
+/** Estimates the size of the search tree of the XCC problem described by the structure, without exploring it, see
+ * BasicSolver::estimateTreeSize(). Cheap enough to decide, before searching, whether a problem is worth searching at
+ * all, and whether to search it in parallel.
+ * @param dataStructure The data structure representing XCC problem.
+ * @param samplesCount The amount of random paths, which must be positive.
+ * @param seed The seed for the random number generator. Uses a random seed if not available.
+ * @return The estimate.
+ */
+TreeSizeEstimate estimateTreeSize(const DancingCellsStructure& dataStructure,
+                                  int32_t samplesCount,
+                                  const std::optional<int32_t>& seed);
 
 /** Computes whether the XCC problem has exactly one solution. In the case of multiple solutions being present, it has a
  * potential early exit since it can return soon as it finds the second solution. It therefore does not need to explore
@@ -36,7 +519,19 @@ std::optional<std::unordered_set<int32_t>> findOneSolution(DancingCellsStructure
  * @param seed The seed for the random number generator. Uses a random seed if not available.
  * @return If exactly one solution exists, then that solution. Otherwise an empty optional.
  */
-std::optional<std::unordered_set<int32_t>> hasUniqueSolution(DancingCellsStructure& dataStructure,
-                                                             const std::optional<int32_t>& seed);
+std::optional<XccSolution> hasUniqueSolution(const DancingCellsStructure& dataStructure,
+                                             const std::optional<int32_t>& seed);
+
+/** Computes whether the XCC problem has exactly one solution, using multiple threads. The search tree is split like in
+ * findAllSolutionsInParallel(), and the workers share the amount of solutions found so far. As soon as two solutions
+ * are found in total, every worker stops, and the subtrees that are left are skipped.
+ * @param dataStructure The data structure representing XCC problem.
+ * @param seed The seed for the random number generator. Uses a random seed if not available.
+ * @param threadsCount The amount of threads to use. Uses all available hardware threads if not available.
+ * @return If exactly one solution exists, then that solution. Otherwise an empty optional.
+ */
+std::optional<XccSolution> hasUniqueSolutionInParallel(const DancingCellsStructure& dataStructure,
+                                                       const std::optional<int32_t>& seed,
+                                                       const std::optional<int32_t>& threadsCount);
 
 }; // namespace AlgorithmC
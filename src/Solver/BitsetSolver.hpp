@@ -0,0 +1,311 @@
+#pragma once
+
+#include "AlgorithmC.hpp"
+#include "DancingCellsStructure.hpp"
+#include "PuzzleSpace.hpp"
+#include "XccSolution.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+/** Solver for XCC problems that are small enough to represent any set of their options, and any set of their primary
+ * items, as a bitmask made of a fixed amount of 64-bit words.
+ * Instead of unlinking nodes like Algorithm C, choosing an option clears every option that conflicts with it from the
+ * bitmask of the remaining options, and clears its primary items from the bitmask of the items left to cover. These
+ * are a few word-wide AND NOT operations over arrays of a fixed length, which the compiler turns into SIMD
+ * instructions. Every level of the search works on its own copy of both bitmasks, so nothing is undone when
+ * backtracking.
+ *
+ * It finds the same solutions as Algorithm C, but not necessarily in the same order. It always branches on the first
+ * primary item with the fewest remaining options, and tries those options in increasing order, so its searches are
+ * deterministic and don't take a seed.
+ * @tparam wordsCount The amount of words of every bitmask. Each word holds 64 options, or 64 primary items.
+ */
+template <std::size_t wordsCount>
+class BitsetSolver {
+public:
+  /// The maximum amount of options, and the maximum amount of primary items, of the problems the solver accepts
+  static constexpr int32_t capacity = static_cast<int32_t>(wordsCount * 64);
+
+  /** Checks whether a problem is small enough for this solver.
+   * @param dataStructure The data structure representing XCC problem.
+   * @return Whether both its options and its primary items fit in the bitmasks.
+   */
+  static bool fits(const DancingCellsStructure& dataStructure) {
+    return dataStructure.optionsCount <= capacity && dataStructure.primaryItemsCount <= capacity;
+  }
+
+  /** Constructor
+   * @param dataStructure The data structure representing XCC problem, as it was created. It is only read to build the
+   * bitmasks, and the solver doesn't keep any reference to it.
+   */
+  explicit BitsetSolver(const DancingCellsStructure& dataStructure)
+      : primaryItemsCount(dataStructure.primaryItemsCount)
+      , conflictingOptions(dataStructure.optionsCount)
+      , coveredItems(dataStructure.optionsCount)
+      , itemWordsBegin(dataStructure.primaryItemsCount + 1, 0)
+      , choices(dataStructure.primaryItemsCount) {
+    if (!fits(dataStructure)) {
+      throw std::runtime_error(std::string("Too many options or primary items for the bitset solver"));
+    }
+
+    // Gather the options and colors of every item. Before searching, pos() of an item is its ID.
+    const auto& NODE = dataStructure.NODE;
+    std::vector<std::vector<std::pair<int32_t, int32_t>>> itemOptions(dataStructure.itemsCount);
+    for (std::size_t nodeIndex = 1; nodeIndex < NODE.size(); nodeIndex++) {
+      if (NODE[nodeIndex].item <= 0) {
+        // Spacer
+        continue;
+      }
+      const int32_t itemId = dataStructure.SET[NODE[nodeIndex].item - 2];
+      itemOptions[itemId].emplace_back(dataStructure.nodeOptionIndices[nodeIndex], NODE[nodeIndex].color);
+    }
+
+    // Choosing an option removes the other options of its primary items and of its uncolored secondary items, and
+    // the options of its colored secondary items that have any other color
+    for (std::size_t nodeIndex = 1; nodeIndex < NODE.size(); nodeIndex++) {
+      if (NODE[nodeIndex].item <= 0) {
+        continue;
+      }
+      const int32_t optionIndex = dataStructure.nodeOptionIndices[nodeIndex];
+      const int32_t itemId = dataStructure.SET[NODE[nodeIndex].item - 2];
+      const int32_t color = NODE[nodeIndex].color;
+      for (const auto& [otherOptionIndex, otherColor] : itemOptions[itemId]) {
+        if (itemId < primaryItemsCount || color == XccElement::undefinedColor() || otherColor != color) {
+          setBit(conflictingOptions[optionIndex], otherOptionIndex);
+        }
+      }
+      if (itemId < primaryItemsCount) {
+        setBit(coveredItems[optionIndex], itemId);
+      }
+    }
+
+    // The options of a primary item are few and clustered, so only the words that contain any of them are kept
+    for (int32_t itemId = 0; itemId < primaryItemsCount; itemId++) {
+      Bitset options = {};
+      for (const auto& [optionIndex, color] : itemOptions[itemId]) {
+        setBit(options, optionIndex);
+      }
+      for (std::size_t wordIndex = 0; wordIndex < wordsCount; wordIndex++) {
+        if (options[wordIndex] != 0) {
+          itemWords.push_back({static_cast<int32_t>(wordIndex), options[wordIndex]});
+        }
+      }
+      itemWordsBegin[itemId + 1] = static_cast<int32_t>(itemWords.size());
+    }
+
+    for (int32_t optionIndex = 0; optionIndex < dataStructure.optionsCount; optionIndex++) {
+      setBit(initialOptions, optionIndex);
+    }
+    for (int32_t itemId = 0; itemId < primaryItemsCount; itemId++) {
+      setBit(initialItems, itemId);
+    }
+  }
+
+  /** Passes every solution of the problem to the visitor as soon as it is found.
+   * @param visitor Called with the option indices of every solution, in the order that they are found. The search
+   * stops as soon as it returns false.
+   * @return Whether all solutions were visited, or the visitor stopped the search.
+   */
+  AlgorithmC::SearchStatus forEachSolution(const AlgorithmC::SolutionVisitor& visitor) {
+    return visitSolutions(visitor);
+  }
+
+  /** Retrieves all solutions of the problem.
+   * @return The solutions, in the order that they are found.
+   */
+  std::vector<XccSolution> findAllSolutions() {
+    std::vector<XccSolution> solutions;
+    visitSolutions([&](std::span<const int32_t> optionIndices) {
+      solutions.emplace_back(optionIndices);
+      return true;
+    });
+    return solutions;
+  }
+
+  /** Counts the solutions of the problem, without storing any of them.
+   * @param limit The amount of solutions after which counting stops early. Counts all solutions if not available.
+   * @return The amount of solutions, which is at most the limit.
+   */
+  int64_t countSolutions(const std::optional<int64_t>& limit) {
+    if (limit.has_value() && limit.value() <= 0) {
+      return 0;
+    }
+    int64_t solutionsCount = 0;
+    visitSolutions([&](std::span<const int32_t>) {
+      solutionsCount++;
+      return !limit.has_value() || solutionsCount < limit.value();
+    });
+    return solutionsCount;
+  }
+
+  /** Retrieves the first solution found of the problem.
+   * @return If there's at least one, a solution of the XCC problem. Returns an empty optional otherwise.
+   */
+  std::optional<XccSolution> findOneSolution() {
+    std::optional<XccSolution> solution;
+    visitSolutions([&](std::span<const int32_t> optionIndices) {
+      solution = XccSolution(optionIndices);
+      return false;
+    });
+    return solution;
+  }
+
+  /** Computes whether the problem has exactly one solution, stopping as soon as a second one is found.
+   * @return If exactly one solution exists, then that solution. Otherwise an empty optional.
+   */
+  std::optional<XccSolution> hasUniqueSolution() {
+    std::optional<XccSolution> solution;
+    int64_t solutionsCount = 0;
+    visitSolutions([&](std::span<const int32_t> optionIndices) {
+      solutionsCount++;
+      if (solutionsCount == 1) {
+        solution = XccSolution(optionIndices);
+      }
+      return solutionsCount < 2;
+    });
+    return solutionsCount == 1 ? solution : std::nullopt;
+  }
+
+private:
+  /// A set of options, or a set of primary items
+  using Bitset = std::array<uint64_t, wordsCount>;
+
+  /** A word of the bitmask of the options of a primary item, which contains at least one of them.
+   */
+  struct ItemWord {
+    /// The index of the word in the bitmask
+    int32_t index = 0;
+    /// The options of the item in that word
+    uint64_t bits = 0;
+  };
+
+  /** Adds an element to a set.
+   * @param bitset The set.
+   * @param index The index of the element.
+   */
+  static void setBit(Bitset& bitset, int32_t index) {
+    bitset[index / 64] |= uint64_t{1} << (index % 64);
+  }
+
+  /** Finds the first primary item left to cover with the fewest remaining options. Stops at the first item that has
+   * at most one, since no other item can be a better choice.
+   * @param options The remaining options.
+   * @param items The primary items left to cover, of which there is at least one.
+   * @param smallestSize Set to the amount of remaining options of the item.
+   * @return The ID of the item.
+   */
+  int32_t pickItem(const Bitset& options, const Bitset& items, int32_t& smallestSize) const {
+    int32_t bestItemId = -1;
+    smallestSize = capacity + 1;
+    for (std::size_t wordIndex = 0; wordIndex < wordsCount; wordIndex++) {
+      for (uint64_t bits = items[wordIndex]; bits != 0; bits &= bits - 1) {
+        const int32_t itemId = static_cast<int32_t>(wordIndex * 64) + std::countr_zero(bits);
+        int32_t size = 0;
+        for (int32_t itemWord = itemWordsBegin[itemId]; itemWord < itemWordsBegin[itemId + 1]; itemWord++) {
+          size += std::popcount(options[itemWords[itemWord].index] & itemWords[itemWord].bits);
+        }
+        if (size < smallestSize) {
+          smallestSize = size;
+          bestItemId = itemId;
+          if (size <= 1) {
+            return bestItemId;
+          }
+        }
+      }
+    }
+    return bestItemId;
+  }
+
+  /** Runs the search from the start, and reports every solution that it finds.
+   * @param visitor Called with the option indices of every solution found. Returns whether the search should continue.
+   * @return Whether the search explored the whole tree, or was stopped by the visitor.
+   */
+  template <typename Visitor>
+  AlgorithmC::SearchStatus visitSolutions(Visitor&& visitor) {
+    // Like Algorithm C, a problem without primary items has no solutions
+    if (primaryItemsCount == 0 || search(initialOptions, initialItems, 0, visitor)) {
+      return AlgorithmC::SearchStatus::Exhausted;
+    }
+    return AlgorithmC::SearchStatus::Stopped;
+  }
+
+  /** Explores the subtree of the search below the options chosen so far, and reports the solutions found.
+   * @param options The options that don't conflict with any option chosen so far.
+   * @param items The primary items that no option chosen so far covers.
+   * @param level The amount of options chosen so far.
+   * @param visitor Called with the option indices of every solution found. Returns whether the search should continue.
+   * @return Whether the search should continue.
+   */
+  template <typename Visitor>
+  bool search(const Bitset& options, const Bitset& items, int32_t level, Visitor& visitor) {
+    if (std::ranges::all_of(items, [](uint64_t word) { return word == 0; })) {
+      return visitor(std::span<const int32_t>(choices.data(), level));
+    }
+    int32_t smallestSize = 0;
+    const int32_t itemId = pickItem(options, items, smallestSize);
+    if (smallestSize == 0) {
+      return true;
+    }
+    for (int32_t itemWord = itemWordsBegin[itemId]; itemWord < itemWordsBegin[itemId + 1]; itemWord++) {
+      const int32_t wordIndex = itemWords[itemWord].index;
+      for (uint64_t bits = options[wordIndex] & itemWords[itemWord].bits; bits != 0; bits &= bits - 1) {
+        const int32_t optionIndex = wordIndex * 64 + std::countr_zero(bits);
+        choices[level] = optionIndex;
+        Bitset nextOptions;
+        Bitset nextItems;
+        for (std::size_t index = 0; index < wordsCount; index++) {
+          nextOptions[index] = options[index] & ~conflictingOptions[optionIndex][index];
+          nextItems[index] = items[index] & ~coveredItems[optionIndex][index];
+        }
+        if (!search(nextOptions, nextItems, level + 1, visitor)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  /// The amount of primary items
+  int32_t primaryItemsCount = 0;
+  /// Every option of the problem, which remain before anything is chosen
+  Bitset initialOptions = {};
+  /// Every primary item, which are left to cover before anything is chosen
+  Bitset initialItems = {};
+  /// The options that can't be chosen together with each option, including the option itself
+  std::vector<Bitset> conflictingOptions;
+  /// The primary items of each option
+  std::vector<Bitset> coveredItems;
+  /// The words of the bitmasks of the options of every primary item, that contain any of them
+  std::vector<ItemWord> itemWords;
+  /// Where the words of each primary item begin in itemWords, followed by where the last one ends
+  std::vector<int32_t> itemWordsBegin;
+  /// The option chosen on each level
+  std::vector<int32_t> choices;
+};
+
+/// The widest bitmasks, in words, for which the bitset solver is preferred over Algorithm C. Beyond that, copying and
+/// scanning the bitmasks on every level costs more than the nodes that Algorithm C updates.
+constexpr std::size_t maximumBitsetWordsCount = 16;
+
+/// The amount of words that a bitmask needs to hold every option of the puzzles of a puzzle space
+template <PuzzleSpace puzzleSpace>
+constexpr std::size_t bitsetWordsCount =
+    (static_cast<std::size_t>(puzzleSpace.rowsCount) * puzzleSpace.columnsCount * puzzleSpace.digitsCount + 63) / 64;
+
+/// Whether the puzzles of a puzzle space are small enough for the bitset solver to be preferred over Algorithm C
+template <PuzzleSpace puzzleSpace>
+constexpr bool isBitsetSolverPreferred = bitsetWordsCount<puzzleSpace> <= maximumBitsetWordsCount;
+
+/// The bitset solver whose bitmasks fit the options of the puzzles of a puzzle space
+template <PuzzleSpace puzzleSpace>
+using PuzzleBitsetSolver = BitsetSolver<bitsetWordsCount<puzzleSpace>>;
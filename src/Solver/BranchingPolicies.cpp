@@ -0,0 +1,142 @@
+#include "BranchingPolicies.hpp"
+
+#include <algorithm>
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
+template <std::signed_integral Index>
+void AlgorithmC::RandomMrvPolicy::start(BasicDancingCellsStructure<Index>&, const std::optional<int32_t>& seed) {
+  randomGenerator = RandomGenerator(seed);
+}
+
+template <std::signed_integral Index>
+void AlgorithmC::ReservoirMrvPolicy::start(BasicDancingCellsStructure<Index>&, const std::optional<int32_t>& seed) {
+  // The xorshift generator gets stuck on zero, so it is seeded with a strictly positive number
+  state = static_cast<uint32_t>(RandomGenerator(seed).uniformInteger(1, std::numeric_limits<int32_t>::max()));
+}
+
+AlgorithmC::PreferredItemsMrvPolicy::PreferredItemsMrvPolicy(int32_t firstPreferredItemId, int32_t preferredItemsCount)
+    : firstPreferredItemId(firstPreferredItemId)
+    , preferredItemsCount(preferredItemsCount) {}
+
+template <std::signed_integral Index>
+void AlgorithmC::PreferredItemsMrvPolicy::start(BasicDancingCellsStructure<Index>& structure,
+                                                const std::optional<int32_t>&) {
+  // Before searching, ITEM lists the items in the order of their IDs, and their blocks in SET are in that same order
+  const int32_t firstItemId = std::clamp(firstPreferredItemId, 0, structure.primaryItemsCount);
+  const int32_t lastItemId =
+      std::clamp(firstPreferredItemId + preferredItemsCount, firstItemId, structure.primaryItemsCount);
+  if (firstItemId == lastItemId) {
+    // Nothing is preferred
+    preferredSetBegin = 0;
+    preferredSetEnd = 0;
+    return;
+  }
+  preferredSetBegin = structure.ITEM[firstItemId];
+  // Only primary items are compared, so the range may run up to the end of the list
+  preferredSetEnd =
+      lastItemId < structure.itemsCount ? structure.ITEM[lastItemId] : std::numeric_limits<int32_t>::max();
+}
+
+template <std::signed_integral Index>
+void AlgorithmC::BucketMrvPolicy::start(BasicDancingCellsStructure<Index>& structure, const std::optional<int32_t>&) {
+  // Sizes only shrink while searching, so the largest size that was loaded bounds the amount of buckets
+  int32_t largestSize = 0;
+  for (int32_t itemIndex = 0; itemIndex < structure.primaryItemsCount; itemIndex++) {
+    largestSize = std::max<int32_t>(largestSize, structure.size(structure.ITEM[itemIndex]));
+  }
+  bucketHeads.assign(largestSize + 1, -1);
+  nextItems.assign(structure.SET.size(), -1);
+  previousItems.assign(structure.SET.size(), -1);
+  smallestSize = largestSize;
+  activeItemsCount = 0;
+  // Every primary item is active before searching. Linking them backwards makes the first one the head of its bucket.
+  for (int32_t itemIndex = structure.primaryItemsCount - 1; itemIndex >= 0; itemIndex--) {
+    reactivateItem(structure.ITEM[itemIndex], structure.size(structure.ITEM[itemIndex]));
+  }
+}
+
+std::size_t AlgorithmC::findFirstSmallest(std::span<const int32_t> values, int32_t smallEnough) {
+  if (values.empty() || values.front() <= smallEnough) {
+    return 0;
+  }
+  // From here on, smallEnough is smaller than the first value, and therefore smaller than the maximum int32_t
+  int32_t smallestValue = std::numeric_limits<int32_t>::max();
+  std::size_t index = 0;
+#if defined(__AVX2__)
+  // Keep the smallest value of every lane, until a whole register has been seen with a value that is small enough
+  const __m256i largeValues = _mm256_set1_epi32(smallEnough + 1);
+  __m256i smallestValues = _mm256_set1_epi32(smallestValue);
+  for (; index + 8 <= values.size(); index += 8) {
+    const __m256i nextValues = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values.data() + index));
+    if (!_mm256_testz_si256(_mm256_cmpgt_epi32(largeValues, nextValues), _mm256_set1_epi32(-1))) {
+      break;
+    }
+    smallestValues = _mm256_min_epi32(smallestValues, nextValues);
+  }
+  __m128i smallestHalves =
+      _mm_min_epi32(_mm256_castsi256_si128(smallestValues), _mm256_extracti128_si256(smallestValues, 1));
+  smallestHalves = _mm_min_epi32(smallestHalves, _mm_shuffle_epi32(smallestHalves, _MM_SHUFFLE(1, 0, 3, 2)));
+  smallestHalves = _mm_min_epi32(smallestHalves, _mm_shuffle_epi32(smallestHalves, _MM_SHUFFLE(2, 3, 0, 1)));
+  smallestValue = _mm_cvtsi128_si32(smallestHalves);
+#elif defined(__SSE4_1__)
+  // Keep the smallest value of every lane, until a whole register has been seen with a value that is small enough
+  const __m128i largeValues = _mm_set1_epi32(smallEnough + 1);
+  __m128i smallestValues = _mm_set1_epi32(smallestValue);
+  for (; index + 4 <= values.size(); index += 4) {
+    const __m128i nextValues = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values.data() + index));
+    if (!_mm_testz_si128(_mm_cmpgt_epi32(largeValues, nextValues), _mm_set1_epi32(-1))) {
+      break;
+    }
+    smallestValues = _mm_min_epi32(smallestValues, nextValues);
+  }
+  smallestValues = _mm_min_epi32(smallestValues, _mm_shuffle_epi32(smallestValues, _MM_SHUFFLE(1, 0, 3, 2)));
+  smallestValues = _mm_min_epi32(smallestValues, _mm_shuffle_epi32(smallestValues, _MM_SHUFFLE(2, 3, 0, 1)));
+  smallestValue = _mm_cvtsi128_si32(smallestValues);
+#endif
+  // The values that don't fill a whole register, or all of them without SIMD instructions. The registers before the
+  // current index have no value that is small enough, so the first one is found here as well.
+  std::optional<std::size_t> smallestIndex;
+  for (; index < values.size(); index++) {
+    if (values[index] <= smallEnough) {
+      return index;
+    }
+    if (values[index] < smallestValue) {
+      // Nothing before this value is as small
+      smallestValue = values[index];
+      smallestIndex = index;
+    }
+  }
+  if (smallestIndex.has_value()) {
+    return smallestIndex.value();
+  }
+  // The smallest value was seen in a register, look for its first occurrence
+  return static_cast<std::size_t>(std::ranges::find(values, smallestValue) - values.begin());
+}
+
+template <std::signed_integral Index>
+void AlgorithmC::SizeTableMrvPolicy::start(BasicDancingCellsStructure<Index>& structure,
+                                           const std::optional<int32_t>&) {
+  const int32_t paddedCount = (structure.primaryItemsCount + paddingSize - 1) / paddingSize * paddingSize;
+  items.assign(paddedCount, 0);
+  sizes.assign(paddedCount, std::numeric_limits<int32_t>::max());
+  positions.assign(structure.SET.size(), -1);
+  activeItemsCount = 0;
+  // Every primary item is active before searching
+  for (int32_t itemIndex = 0; itemIndex < structure.primaryItemsCount; itemIndex++) {
+    reactivateItem(structure.ITEM[itemIndex], structure.size(structure.ITEM[itemIndex]));
+  }
+}
+
+template void AlgorithmC::RandomMrvPolicy::start(DancingCellsStructure&, const std::optional<int32_t>&);
+template void AlgorithmC::RandomMrvPolicy::start(CompactDancingCellsStructure&, const std::optional<int32_t>&);
+template void AlgorithmC::ReservoirMrvPolicy::start(DancingCellsStructure&, const std::optional<int32_t>&);
+template void AlgorithmC::ReservoirMrvPolicy::start(CompactDancingCellsStructure&, const std::optional<int32_t>&);
+template void AlgorithmC::PreferredItemsMrvPolicy::start(DancingCellsStructure&, const std::optional<int32_t>&);
+template void AlgorithmC::PreferredItemsMrvPolicy::start(CompactDancingCellsStructure&, const std::optional<int32_t>&);
+template void AlgorithmC::BucketMrvPolicy::start(DancingCellsStructure&, const std::optional<int32_t>&);
+template void AlgorithmC::BucketMrvPolicy::start(CompactDancingCellsStructure&, const std::optional<int32_t>&);
+template void AlgorithmC::SizeTableMrvPolicy::start(DancingCellsStructure&, const std::optional<int32_t>&);
+template void AlgorithmC::SizeTableMrvPolicy::start(CompactDancingCellsStructure&, const std::optional<int32_t>&);
@@ -0,0 +1,496 @@
+#pragma once
+
+#include "DancingCellsStructure.hpp"
+#include "RandomGenerator.hpp"
+#include "SearchStatistics.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace AlgorithmC {
+
+/** Concept for a branching policy, which decides on which item Algorithm C branches at every level of the search.
+ * Every policy implements the "minimum remaining values" (MRV) heuristic: it picks one of the active primary items with
+ * the fewest options left. Policies only differ in how they break ties between such items.
+ * @tparam BranchingPolicy The branching policy to which the concept will apply.
+ * @tparam Index The integer type of the indices of the structure that the policy works on.
+ */
+template <typename BranchingPolicy, typename Index = int32_t>
+concept BranchingPolicyConcept =
+    std::copyable<BranchingPolicy> && requires(BranchingPolicy policy,
+                                               BasicDancingCellsStructure<Index>& structure,
+                                               const std::optional<int32_t>& seed,
+                                               int32_t count,
+                                               int32_t& result,
+                                               SearchStatistics& statistics) {
+      // Called at the start of every search, on the structure as it was loaded
+      policy.start(structure, seed);
+      // Called on every node of the search tree to pick the item to branch on
+      policy.pickItem(structure, count, count, result, result, statistics);
+    };
+
+/** Concept for a branching policy that keeps track of the sizes of the active primary items itself, instead of scanning
+ * the active list for every pick. The search tells it about every change to the sizes of those items, and about every
+ * primary item that leaves or re-enters the active list.
+ * @tparam BranchingPolicy The branching policy to which the concept will apply.
+ */
+template <typename BranchingPolicy>
+concept IncrementalBranchingPolicyConcept =
+    BranchingPolicyConcept<BranchingPolicy> && requires(BranchingPolicy policy, int32_t itemIndex, int32_t size) {
+      // Called right before the size of an active primary item changes
+      policy.resizeItem(itemIndex, size, size);
+      // Called when an active primary item leaves the active list, with its current size
+      policy.deactivateItem(itemIndex, size);
+      // Called when a primary item re-enters the active list, with its restored size
+      policy.reactivateItem(itemIndex, size);
+    };
+
+/** Picks the first of the items with the smallest length in the active list. It never draws any random numbers, so the
+ * search tree only depends on the structure and not on the seed.
+ */
+class FirstMrvPolicy {
+public:
+  /** Prepares a new search. Nothing needs to be prepared.
+   */
+  template <std::signed_integral Index>
+  void start(BasicDancingCellsStructure<Index>&, const std::optional<int32_t>&) {}
+
+  /** Selects the first of the items with smallest length in the active list of the data structure.
+   * @param structure A reference to the structure currently being used
+   * @param active The amount of active items in the structure
+   * @param second The index of the first secondary item in the structure
+   * @param smallestSizeFoundSoFar A reference to the smallest size found so far, enter this function as the maximum
+   * int32_t allowed.
+   * @param bestItemIndex The item in the datastructure that has been picked
+   * @param statistics The statistics of the current search
+   */
+  template <std::signed_integral Index>
+  void pickItem(BasicDancingCellsStructure<Index>& structure,
+                int32_t active,
+                int32_t second,
+                int32_t& smallestSizeFoundSoFar,
+                int32_t& bestItemIndex,
+                [[maybe_unused]] SearchStatistics& statistics) {
+    for (int32_t itemIndex = 0; smallestSizeFoundSoFar > 1 && itemIndex < active; itemIndex++) {
+      RECORD_STATISTICS(statistics.mems++);
+      const int32_t setIndex = structure.ITEM[itemIndex];
+      if (setIndex < second) {
+        RECORD_STATISTICS(statistics.mems++);
+        const int32_t sizeOfItem = structure.size(setIndex);
+        if (sizeOfItem < smallestSizeFoundSoFar) {
+          bestItemIndex = setIndex;
+          smallestSizeFoundSoFar = sizeOfItem;
+        }
+      }
+    }
+  }
+};
+
+/** Picks one of the items with the smallest length in the active list uniformly at random, by drawing a random float
+ * from the random number generator for every tie. This is the default policy.
+ */
+class RandomMrvPolicy {
+public:
+  /** Prepares a new search by reseeding the random number generator.
+   * @param seed The seed for the random number generator. Uses a random seed if not available.
+   */
+  template <std::signed_integral Index>
+  void start(BasicDancingCellsStructure<Index>&, const std::optional<int32_t>& seed);
+
+  /** Selects one the of the items with smallest length in the active list of the data structure. If there are
+   * multiple items with the same smallest length, it selects one of those at random.
+   * @param structure A reference to the structure currently being used
+   * @param active The amount of active items in the structure
+   * @param second The index of the first secondary item in the structure
+   * @param smallestSizeFoundSoFar A reference to the smallest size found so far, enter this function as the maximum
+   * int32_t allowed.
+   * @param bestItemIndex The item in the datastructure that has been picked
+   * @param statistics The statistics of the current search
+   */
+  template <std::signed_integral Index>
+  void pickItem(BasicDancingCellsStructure<Index>& structure,
+                int32_t active,
+                int32_t second,
+                int32_t& smallestSizeFoundSoFar,
+                int32_t& bestItemIndex,
+                [[maybe_unused]] SearchStatistics& statistics) {
+    int32_t smallestSizeNodesAmount = 0;
+    for (int32_t itemIndex = 0; smallestSizeFoundSoFar > 1 && itemIndex < active; itemIndex++) {
+      RECORD_STATISTICS(statistics.mems++);
+      const int32_t setIndex = structure.ITEM[itemIndex];
+      if (setIndex < second) {
+        RECORD_STATISTICS(statistics.mems++);
+        const int32_t sizeOfItem = structure.size(setIndex);
+        if (sizeOfItem < smallestSizeFoundSoFar) {
+          // New size is smaller than the smallest one found so far, select it
+          bestItemIndex = setIndex;
+          smallestSizeFoundSoFar = sizeOfItem;
+          smallestSizeNodesAmount = 1;
+        } else if (sizeOfItem == smallestSizeFoundSoFar) {
+          // New size is equal to the smallest one found so far, randomly select it.
+          smallestSizeNodesAmount++;
+          // Chance to select this item is: one over the amount of items found so far with this smallest size.
+          // This ensures that every item with smallest size has an equal probability of being selected.
+          const bool needToSelectThisItem =
+              randomGenerator.uniformFloat(0.0f, 1.0f) < (1.0f / static_cast<float>(smallestSizeNodesAmount));
+          if (needToSelectThisItem) {
+            bestItemIndex = setIndex;
+          }
+        }
+      }
+    }
+  }
+
+private:
+  /// Picks items at random when multiple ones are equally good
+  RandomGenerator randomGenerator = RandomGenerator(0);
+};
+
+/** Picks one of the items with the smallest length in the active list at random, like RandomMrvPolicy, but draws the
+ * random numbers from a xorshift generator and keeps ties with a multiplication instead of a floating point division.
+ */
+class ReservoirMrvPolicy {
+public:
+  /** Prepares a new search by reseeding the xorshift generator.
+   * @param seed The seed for the random number generator. Uses a random seed if not available.
+   */
+  template <std::signed_integral Index>
+  void start(BasicDancingCellsStructure<Index>&, const std::optional<int32_t>& seed);
+
+  /** Selects one the of the items with smallest length in the active list of the data structure. If there are
+   * multiple items with the same smallest length, it selects one of those at random with reservoir sampling.
+   * @param structure A reference to the structure currently being used
+   * @param active The amount of active items in the structure
+   * @param second The index of the first secondary item in the structure
+   * @param smallestSizeFoundSoFar A reference to the smallest size found so far, enter this function as the maximum
+   * int32_t allowed.
+   * @param bestItemIndex The item in the datastructure that has been picked
+   * @param statistics The statistics of the current search
+   */
+  template <std::signed_integral Index>
+  void pickItem(BasicDancingCellsStructure<Index>& structure,
+                int32_t active,
+                int32_t second,
+                int32_t& smallestSizeFoundSoFar,
+                int32_t& bestItemIndex,
+                [[maybe_unused]] SearchStatistics& statistics) {
+    uint32_t smallestSizeNodesAmount = 0;
+    for (int32_t itemIndex = 0; smallestSizeFoundSoFar > 1 && itemIndex < active; itemIndex++) {
+      RECORD_STATISTICS(statistics.mems++);
+      const int32_t setIndex = structure.ITEM[itemIndex];
+      if (setIndex < second) {
+        RECORD_STATISTICS(statistics.mems++);
+        const int32_t sizeOfItem = structure.size(setIndex);
+        if (sizeOfItem < smallestSizeFoundSoFar) {
+          bestItemIndex = setIndex;
+          smallestSizeFoundSoFar = sizeOfItem;
+          smallestSizeNodesAmount = 1;
+        } else if (sizeOfItem == smallestSizeFoundSoFar) {
+          smallestSizeNodesAmount++;
+          // Scaling a random 32 bit number by the amount of ties gives a number in [0, smallestSizeNodesAmount), which
+          // is zero with a chance of one over the amount of ties
+          if (((static_cast<uint64_t>(nextRandomNumber()) * smallestSizeNodesAmount) >> 32) == 0) {
+            bestItemIndex = setIndex;
+          }
+        }
+      }
+    }
+  }
+
+private:
+  /** Advances the xorshift generator.
+   * @return A random 32 bit number.
+   */
+  uint32_t nextRandomNumber() {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+  }
+
+  /// The state of the xorshift generator, which must never be zero
+  uint32_t state = 1;
+};
+
+/** Picks the first of the items with the smallest length in the active list, preferring a chosen range of primary items
+ * when there is a tie. For a puzzle, the range is typically the primary items of one of its constraints, such that the
+ * search branches on that constraint whenever it is as constrained as any other.
+ */
+class PreferredItemsMrvPolicy {
+public:
+  /** Constructor
+   * @param firstPreferredItemId The ID of the first preferred primary item.
+   * @param preferredItemsCount The amount of consecutive preferred primary items.
+   */
+  PreferredItemsMrvPolicy(int32_t firstPreferredItemId = 0, int32_t preferredItemsCount = 0);
+
+  /** Prepares a new search by locating the preferred items in the SET list.
+   * @param structure The structure as it was loaded
+   */
+  template <std::signed_integral Index>
+  void start(BasicDancingCellsStructure<Index>& structure, const std::optional<int32_t>&);
+
+  /** Selects the first of the items with smallest length in the active list of the data structure, unless one of the
+   * preferred items has that same length.
+   * @param structure A reference to the structure currently being used
+   * @param active The amount of active items in the structure
+   * @param second The index of the first secondary item in the structure
+   * @param smallestSizeFoundSoFar A reference to the smallest size found so far, enter this function as the maximum
+   * int32_t allowed.
+   * @param bestItemIndex The item in the datastructure that has been picked
+   * @param statistics The statistics of the current search
+   */
+  template <std::signed_integral Index>
+  void pickItem(BasicDancingCellsStructure<Index>& structure,
+                int32_t active,
+                int32_t second,
+                int32_t& smallestSizeFoundSoFar,
+                int32_t& bestItemIndex,
+                [[maybe_unused]] SearchStatistics& statistics) {
+    bool isBestItemPreferred = false;
+    // No item beats a preferred item with a single option, or any item without options
+    for (int32_t itemIndex = 0;
+         smallestSizeFoundSoFar > 0 && !(smallestSizeFoundSoFar == 1 && isBestItemPreferred) && itemIndex < active;
+         itemIndex++) {
+      RECORD_STATISTICS(statistics.mems++);
+      const int32_t setIndex = structure.ITEM[itemIndex];
+      if (setIndex < second) {
+        RECORD_STATISTICS(statistics.mems++);
+        const int32_t sizeOfItem = structure.size(setIndex);
+        // The items keep their place in the SET list, so the preferred ones are found by their index
+        const bool isItemPreferred = setIndex >= preferredSetBegin && setIndex < preferredSetEnd;
+        if (sizeOfItem < smallestSizeFoundSoFar ||
+            (sizeOfItem == smallestSizeFoundSoFar && isItemPreferred && !isBestItemPreferred)) {
+          bestItemIndex = setIndex;
+          smallestSizeFoundSoFar = sizeOfItem;
+          isBestItemPreferred = isItemPreferred;
+        }
+      }
+    }
+  }
+
+private:
+  /// The ID of the first preferred primary item
+  int32_t firstPreferredItemId = 0;
+  /// The amount of consecutive preferred primary items
+  int32_t preferredItemsCount = 0;
+  /// The index in SET of the first preferred item
+  int32_t preferredSetBegin = 0;
+  /// The index in SET right after the last preferred item
+  int32_t preferredSetEnd = 0;
+};
+
+/** Picks one of the items with the smallest length in the active list, without scanning the list. The active primary
+ * items are kept in buckets by their size, which are updated as the sizes change. Picking an item then only needs to
+ * look for the first non-empty bucket, starting from a lower bound of the smallest size. Of the items with the smallest
+ * size, the one that got that size last is picked.
+ */
+class BucketMrvPolicy {
+public:
+  /** Prepares a new search by putting every primary item in the bucket of its size.
+   * @param structure The structure as it was loaded
+   */
+  template <std::signed_integral Index>
+  void start(BasicDancingCellsStructure<Index>& structure, const std::optional<int32_t>&);
+
+  /** Selects an item with the smallest length from the buckets.
+   * @param smallestSizeFoundSoFar A reference to the smallest size found so far, enter this function as the maximum
+   * int32_t allowed.
+   * @param bestItemIndex The item in the datastructure that has been picked
+   * @param statistics The statistics of the current search
+   */
+  template <std::signed_integral Index>
+  void pickItem(BasicDancingCellsStructure<Index>&,
+                int32_t,
+                int32_t,
+                int32_t& smallestSizeFoundSoFar,
+                int32_t& bestItemIndex,
+                [[maybe_unused]] SearchStatistics& statistics) {
+    if (activeItemsCount == 0) {
+      return;
+    }
+    while (bucketHeads[smallestSize] < 0) {
+      RECORD_STATISTICS(statistics.mems++);
+      smallestSize++;
+    }
+    RECORD_STATISTICS(statistics.mems++);
+    bestItemIndex = bucketHeads[smallestSize];
+    smallestSizeFoundSoFar = smallestSize;
+  }
+
+  /** Moves an active primary item to the bucket of its new size.
+   * @param itemIndex The index of the item in SET
+   * @param oldSize The size of the item before the change
+   * @param newSize The size of the item after the change
+   */
+  void resizeItem(int32_t itemIndex, int32_t oldSize, int32_t newSize) {
+    unlink(itemIndex, oldSize);
+    link(itemIndex, newSize);
+  }
+
+  /** Takes a primary item out of the buckets.
+   * @param itemIndex The index of the item in SET
+   * @param size The size of the item
+   */
+  void deactivateItem(int32_t itemIndex, int32_t size) {
+    unlink(itemIndex, size);
+    activeItemsCount--;
+  }
+
+  /** Puts a primary item back in the buckets.
+   * @param itemIndex The index of the item in SET
+   * @param size The size of the item
+   */
+  void reactivateItem(int32_t itemIndex, int32_t size) {
+    link(itemIndex, size);
+    activeItemsCount++;
+  }
+
+private:
+  /** Adds an item to the front of a bucket.
+   * @param itemIndex The index of the item in SET
+   * @param size The size of the item, which identifies the bucket
+   */
+  void link(int32_t itemIndex, int32_t size) {
+    const int32_t headIndex = bucketHeads[size];
+    nextItems[itemIndex] = headIndex;
+    previousItems[itemIndex] = -1;
+    if (headIndex >= 0) {
+      previousItems[headIndex] = itemIndex;
+    }
+    bucketHeads[size] = itemIndex;
+    smallestSize = std::min(smallestSize, size);
+  }
+
+  /** Removes an item from a bucket.
+   * @param itemIndex The index of the item in SET
+   * @param size The size of the item, which identifies the bucket
+   */
+  void unlink(int32_t itemIndex, int32_t size) {
+    const int32_t previousIndex = previousItems[itemIndex];
+    const int32_t nextIndex = nextItems[itemIndex];
+    if (previousIndex >= 0) {
+      nextItems[previousIndex] = nextIndex;
+    } else {
+      bucketHeads[size] = nextIndex;
+    }
+    if (nextIndex >= 0) {
+      previousItems[nextIndex] = previousIndex;
+    }
+  }
+
+  /// The first item of every bucket, or -1 if the bucket is empty. Sizes never grow beyond the ones that were loaded.
+  std::vector<int32_t> bucketHeads;
+  /// The next item in the bucket of each item, or -1, indexed by the index of the item in SET
+  std::vector<int32_t> nextItems;
+  /// The previous item in the bucket of each item, or -1, indexed by the index of the item in SET
+  std::vector<int32_t> previousItems;
+  /// A lower bound for the size of the smallest non-empty bucket
+  int32_t smallestSize = 0;
+  /// The amount of items in the buckets
+  int32_t activeItemsCount = 0;
+};
+
+/** Finds the first of the smallest values, using AVX2 or SSE4.1 instructions when the build targets them.
+ * @param values The values to search through
+ * @param smallEnough The search stops at the first value that is at most this one, like the MRV scan does for items
+ * with a single option left.
+ * @return The index of the first value that is small enough. If there is none, the index of the first smallest value,
+ * or the amount of values if there are none.
+ */
+std::size_t findFirstSmallest(std::span<const int32_t> values,
+                              int32_t smallEnough = std::numeric_limits<int32_t>::min());
+
+/** Picks an item with the smallest length from a table of its own. The table keeps the sizes of the active primary
+ * items contiguous, rather than behind the ITEM indirection and interleaved with the positions in SET, such that the
+ * smallest size is found with SIMD instructions. The table is padded up to a multiple of the SIMD width with sizes that
+ * are never picked, so the search never has to deal with a remainder.
+ *
+ * Ties are broken in table order, not in the order of the active list like FirstMrvPolicy does. The table starts out in
+ * the order of ITEM, so the first pick is the same, but deactivating an item moves the last one into its place and
+ * reactivating appends it. Once the search has branched, the items picked, and thereby the order of the solutions, can
+ * differ from FirstMrvPolicy. Like it, the policy never draws random numbers.
+ */
+class SizeTableMrvPolicy {
+public:
+  /** Prepares a new search by filling the table with every primary item.
+   * @param structure The structure as it was loaded
+   */
+  template <std::signed_integral Index>
+  void start(BasicDancingCellsStructure<Index>& structure, const std::optional<int32_t>&);
+
+  /** Selects the item with smallest length that comes first in the table.
+   * @param smallestSizeFoundSoFar A reference to the smallest size found so far, enter this function as the maximum
+   * int32_t allowed.
+   * @param bestItemIndex The item in the datastructure that has been picked
+   * @param statistics The statistics of the current search
+   */
+  template <std::signed_integral Index>
+  void pickItem(BasicDancingCellsStructure<Index>&,
+                int32_t,
+                int32_t,
+                int32_t& smallestSizeFoundSoFar,
+                int32_t& bestItemIndex,
+                [[maybe_unused]] SearchStatistics& statistics) {
+    if (activeItemsCount == 0) {
+      return;
+    }
+    const auto paddedCount = static_cast<std::size_t>((activeItemsCount + paddingSize - 1) / paddingSize * paddingSize);
+    RECORD_STATISTICS(statistics.mems += static_cast<int64_t>(paddedCount / paddingSize));
+    const std::size_t position = findFirstSmallest(std::span<const int32_t>(sizes.data(), paddedCount), 1);
+    bestItemIndex = items[position];
+    smallestSizeFoundSoFar = sizes[position];
+  }
+
+  /** Updates the size of an active primary item in the table.
+   * @param itemIndex The index of the item in SET
+   * @param newSize The size of the item after the change
+   */
+  void resizeItem(int32_t itemIndex, int32_t, int32_t newSize) {
+    sizes[positions[itemIndex]] = newSize;
+  }
+
+  /** Removes a primary item from the table, by moving the last item of the table in its place.
+   * @param itemIndex The index of the item in SET
+   */
+  void deactivateItem(int32_t itemIndex, int32_t) {
+    const int32_t position = positions[itemIndex];
+    const int32_t lastPosition = --activeItemsCount;
+    items[position] = items[lastPosition];
+    sizes[position] = sizes[lastPosition];
+    positions[items[position]] = position;
+    sizes[lastPosition] = std::numeric_limits<int32_t>::max();
+  }
+
+  /** Adds a primary item to the end of the table.
+   * @param itemIndex The index of the item in SET
+   * @param size The size of the item
+   */
+  void reactivateItem(int32_t itemIndex, int32_t size) {
+    const int32_t position = activeItemsCount++;
+    items[position] = itemIndex;
+    sizes[position] = size;
+    positions[itemIndex] = position;
+  }
+
+private:
+  /// The table is padded to a multiple of this amount of sizes, the amount of sizes in the widest SIMD register
+  static constexpr int32_t paddingSize = 8;
+
+  /// The index in SET of the item at every position of the table
+  std::vector<int32_t> items;
+  /// The size of the item at every position of the table, the maximum int32_t beyond the active items
+  std::vector<int32_t> sizes;
+  /// The position in the table of each item, indexed by the index of the item in SET
+  std::vector<int32_t> positions;
+  /// The amount of items in the table
+  int32_t activeItemsCount = 0;
+};
+
+} // namespace AlgorithmC
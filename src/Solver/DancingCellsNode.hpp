@@ -2,27 +2,33 @@
 #include "XccElement.hpp"
 
 #include <compare>
+#include <concepts>
 #include <cstdint>
 
 /** Struct of data stored in the NODE array of the DancingCellsStructure.
+ * @tparam Index The integer type of the indices, see BasicDancingCellsStructure.
  */
-struct DancingCellsNode {
+template <std::signed_integral Index>
+struct BasicDancingCellsNode {
   /** Default comparison operator
    */
-  auto operator<=>(const DancingCellsNode& other) const = default;
+  auto operator<=>(const BasicDancingCellsNode& other) const = default;
 
   /** The index of the first (reference) node of an item in the SET array for this node.
    * Remains constant througout an Algorithm C's run.
    */
-  int32_t item = 0;
+  Index item = 0;
 
   /** The index of the actual location of the current node in the SET array.
    * This is modified during Algorithm C's run.
    */
-  int32_t location = 0;
+  Index location = 0;
 
   /** The color identification for the current option's node.
    * Remains constant througout an Algorithm C's run.
    */
-  int32_t color = XccElement::undefinedColor();
+  Index color = XccElement::undefinedColor();
 };
+
+/// The node of the structure that every problem is created with
+using DancingCellsNode = BasicDancingCellsNode<int32_t>;
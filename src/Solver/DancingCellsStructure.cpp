@@ -1,18 +1,79 @@
 #include "DancingCellsStructure.hpp"
 
 #include <algorithm>
+#include <cstdlib>
 #include <limits>
+#include <span>
 #include <stdexcept>
 #include <string>
 
-DancingCellsStructure::DancingCellsStructure(int32_t primaryItemsCount,
-                                             int32_t secondaryItemsCount,
-                                             const std::vector<std::vector<XccElement>>& options) {
-  checkOptions(options, primaryItemsCount, primaryItemsCount + secondaryItemsCount);
+namespace {
 
+/** The options of a compressed sparse row layout, seen as a list of options.
+ */
+struct FlatOptions {
+  /** The elements of an option.
+   * @param optionIndex The index of the option.
+   * @return The elements.
+   */
+  std::span<const XccElement> operator[](std::size_t optionIndex) const {
+    return elements.subspan(offsets[optionIndex], offsets[optionIndex + 1] - offsets[optionIndex]);
+  }
+
+  /** The amount of options.
+   * @return The amount of options.
+   */
+  std::size_t size() const {
+    return offsets.size() - 1;
+  }
+
+  /** Whether there are no options.
+   * @return Whether the list is empty.
+   */
+  bool empty() const {
+    return size() == 0;
+  }
+
+  /// The elements of every option, one option after the other
+  std::span<const XccElement> elements;
+  /// Where every option starts in elements, followed by the amount of elements
+  std::span<const int32_t> offsets;
+};
+
+} // namespace
+
+template <std::signed_integral Index>
+BasicDancingCellsStructure<Index>::BasicDancingCellsStructure(int32_t primaryItemsCount,
+                                                              int32_t secondaryItemsCount,
+                                                              const std::vector<std::vector<XccElement>>& options) {
+  initialize(primaryItemsCount, secondaryItemsCount, options);
+}
+
+template <std::signed_integral Index>
+BasicDancingCellsStructure<Index>::BasicDancingCellsStructure(int32_t primaryItemsCount,
+                                                              int32_t secondaryItemsCount,
+                                                              std::span<const XccElement> elements,
+                                                              std::span<const int32_t> offsets) {
+  if (offsets.empty() || offsets.front() != 0 || offsets.back() != static_cast<int32_t>(elements.size()) ||
+      !std::ranges::is_sorted(offsets)) {
+    throw std::runtime_error(std::string("Invalid option offsets"));
+  }
+  initialize(primaryItemsCount, secondaryItemsCount, FlatOptions{elements, offsets});
+}
+
+template <std::signed_integral Index>
+template <typename Options>
+void BasicDancingCellsStructure<Index>::initialize(int32_t primaryItemsCount,
+                                                   int32_t secondaryItemsCount,
+                                                   const Options& options) {
   int32_t nodesCount = 0;
-  for (const auto& option : options) {
-    nodesCount += option.size();
+  int64_t largestColor = 0;
+  checkOptions(options, primaryItemsCount, primaryItemsCount + secondaryItemsCount, nodesCount, largestColor);
+
+  // SET is larger than NODE, and every index and size is smaller than SET
+  const int64_t setSize = nodesCount + 2 * static_cast<int64_t>(primaryItemsCount + secondaryItemsCount);
+  if (std::max(setSize, largestColor) > std::numeric_limits<Index>::max()) {
+    throw std::runtime_error(std::string("The options do not fit in the index type"));
   }
 
   allocateMemoryForMembers(primaryItemsCount, secondaryItemsCount, options.size(), nodesCount);
@@ -24,8 +85,8 @@ DancingCellsStructure::DancingCellsStructure(int32_t primaryItemsCount,
   // SET's memory as temporary storage for data that will be useful whe finishing initialization.
 
   // Prepare NODE by going through all the options and gather as much information as possible
-  int32_t optionIndex = 0;
-  for (const auto& option : options) {
+  for (int32_t optionIndex = 0; optionIndex < static_cast<int32_t>(options.size()); optionIndex++) {
+    const auto& option = options[optionIndex];
     int32_t previousSpacerIndex = lastNode; // Remember the spacer before this option in NODE;
     if (!option.empty()) {
       for (const auto& element : option) {
@@ -35,15 +96,18 @@ DancingCellsStructure::DancingCellsStructure(int32_t primaryItemsCount,
       lastNode++; // Create the next spacer
       NODE[lastNode].item = previousSpacerIndex + 1 - lastNode;
     }
-    optionIndex++;
   }
 
   finishInitialization(second, lastNode);
 }
 
-void DancingCellsStructure::checkOptions(const std::vector<std::vector<XccElement>>& options,
-                                         int32_t primaryItemsCount,
-                                         int32_t itemsCount) {
+template <std::signed_integral Index>
+template <typename Options>
+void BasicDancingCellsStructure<Index>::checkOptions(const Options& options,
+                                                     int32_t primaryItemsCount,
+                                                     int32_t itemsCount,
+                                                     int32_t& nodesCount,
+                                                     int64_t& largestColor) {
 
   const bool noPrimaryItems = primaryItemsCount <= 0;
   const bool noOptions = options.empty();
@@ -51,8 +115,11 @@ void DancingCellsStructure::checkOptions(const std::vector<std::vector<XccElemen
     throw std::runtime_error(std::string("No primary items or options provided"));
   }
 
+  nodesCount = 0;
+  largestColor = 0;
   auto areItemsCoverable = std::vector<bool>(itemsCount, false);
-  for (const auto& option : options) {
+  for (std::size_t optionIndex = 0; optionIndex < options.size(); optionIndex++) {
+    const auto& option = options[optionIndex];
     // Every option must list item IDs in order
     if (!std::is_sorted(option.begin(), option.end())) {
       throw std::runtime_error(std::string("An option's element's IDs are not sorted"));
@@ -61,8 +128,10 @@ void DancingCellsStructure::checkOptions(const std::vector<std::vector<XccElemen
     if (!option.empty() && (option.front().id < 0 || option.back().id >= itemsCount)) {
       throw std::runtime_error(std::string("Invalid item ID"));
     }
+    nodesCount += static_cast<int32_t>(option.size());
     for (const auto& element : option) {
       areItemsCoverable[element.id] = true;
+      largestColor = std::max(largestColor, std::abs(static_cast<int64_t>(element.colorId)));
     }
   }
   if (std::any_of(areItemsCoverable.begin(), areItemsCoverable.end(), [](bool isCoverable) { return !isCoverable; })) {
@@ -70,25 +139,29 @@ void DancingCellsStructure::checkOptions(const std::vector<std::vector<XccElemen
   }
 }
 
-void DancingCellsStructure::allocateMemoryForMembers(int32_t primaryCount,
-                                                     int32_t secondaryCount,
-                                                     int32_t optionsCount,
-                                                     int32_t nodesCount) {
+template <std::signed_integral Index>
+void BasicDancingCellsStructure<Index>::allocateMemoryForMembers(int32_t primaryCount,
+                                                                 int32_t secondaryCount,
+                                                                 int32_t optionsCount,
+                                                                 int32_t nodesCount) {
 
   this->primaryItemsCount = primaryCount;
   this->secondaryItemsCount = secondaryCount;
   itemsCount = primaryItemsCount + secondaryItemsCount;
   this->optionsCount = optionsCount;
 
-  ITEM = std::vector<int32_t>(itemsCount, 0);
+  ITEM = std::vector<Index>(itemsCount, 0);
   const int32_t setPosAndSizeCellsCount = itemsCount * 2;
-  SET = std::vector<int32_t>(nodesCount + setPosAndSizeCellsCount, 0);
+  SET = std::vector<Index>(nodesCount + setPosAndSizeCellsCount, 0);
   const int32_t nodeSpacersCount = optionsCount + 1;
-  NODE = std::vector<DancingCellsNode>(nodesCount + nodeSpacersCount, DancingCellsNode(0, 0, 0));
+  NODE = std::vector<BasicDancingCellsNode<Index>>(nodesCount + nodeSpacersCount, {0, 0, 0});
   nodeOptionIndices.resize(nodesCount + nodeSpacersCount);
 }
 
-void DancingCellsStructure::createNodeForItem(const XccElement& element, int32_t& lastNode, int32_t optionIndex) {
+template <std::signed_integral Index>
+void BasicDancingCellsStructure<Index>::createNodeForItem(const XccElement& element,
+                                                          int32_t& lastNode,
+                                                          int32_t optionIndex) {
   // baseSetIndex is the index in SET to one element after the temporary blocks of pairs (pos, size)
   // I.e. it points to the first element of the next pair, because of how size() and pos() work.
   int32_t baseSetIndex = (element.id + 1) * 2;
@@ -106,7 +179,8 @@ void DancingCellsStructure::createNodeForItem(const XccElement& element, int32_t
   position(baseSetIndex) = lastNode; // Set the index of the last node in NODE where item baseSetIndex has appeared
 }
 
-void DancingCellsStructure::finishInitialization(int32_t second, int32_t lastNode) {
+template <std::signed_integral Index>
+void BasicDancingCellsStructure<Index>::finishInitialization(int32_t second, int32_t lastNode) {
   // Now, after going through all the options, the following explains the contents of NODE and SET.
   // NODE contains:
   // - Already completed spacers, whose attributes are:
@@ -176,6 +250,9 @@ void DancingCellsStructure::finishInitialization(int32_t second, int32_t lastNod
   }
 }
 
+template struct BasicDancingCellsStructure<int16_t>;
+template struct BasicDancingCellsStructure<int32_t>;
+
 // #include <iostream>
 // void DancingCellsStructure::print() const {
 
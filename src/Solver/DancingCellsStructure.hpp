@@ -1,7 +1,18 @@
 #pragma once
 #include "DancingCellsNode.hpp"
 #include "OptionData.hpp"
+#include "StaticDancingCellsStructure.hpp"
+#include "XccElement.hpp"
 
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 /** Data structure used by Algorithm C.
@@ -13,8 +24,14 @@
  * NODE[SET[q]].LOC = q
  * ITEM[pos(x)] = x -> ITEM[SET[x - 2]] = x
  * SET[NODE[y].LOC] = y
+ *
+ * Every index in the three lists, every size of an item and every color is stored as an Index. Problems that are small
+ * enough, such as puzzles up to about 16x16, fit in 16 bit indices. That halves the memory that Algorithm C works on,
+ * which then stays in the faster caches.
+ * @tparam Index The integer type of the indices. DancingCellsStructure, with 32 bit indices, fits every problem.
  */
-struct DancingCellsStructure {
+template <std::signed_integral Index>
+struct BasicDancingCellsStructure {
 public:
   /** Constructor
    * @param primaryItemsCount The amount of primary items (for n primary items: IDs: [0, 1, ..., n-1])
@@ -22,16 +39,93 @@ public:
    * @param options The list of options, each option must contain sorted IDs, therefore the primary items appear first
    * in a single option's list, the secondary items appear at the end.
    */
-  DancingCellsStructure(int32_t primaryItemsCount,
-                        int32_t secondaryItemsCount,
-                        const std::vector<std::vector<XccElement>>& options);
+  BasicDancingCellsStructure(int32_t primaryItemsCount,
+                             int32_t secondaryItemsCount,
+                             const std::vector<std::vector<XccElement>>& options);
+
+  /** Constructor that reads the options from a compressed sparse row layout, such as the one of XccOptions, which is
+   * built without allocating every option on its own.
+   * @param primaryItemsCount The amount of primary items (for n primary items: IDs: [0, 1, ..., n-1])
+   * @param secondaryItemsCount The amount of secondary items (for m secondary items: IDs: [n, n+1, ..., n+m-1])
+   * @param elements The elements of every option, one option after the other. Each option must contain sorted IDs,
+   * see the other constructor.
+   * @param offsets Where every option starts in the elements, followed by the amount of elements.
+   */
+  BasicDancingCellsStructure(int32_t primaryItemsCount,
+                             int32_t secondaryItemsCount,
+                             std::span<const XccElement> elements,
+                             std::span<const int32_t> offsets);
+
+  /** Constructor that copies lists that were created at compile time, see StaticDancingCellsStructure. Nothing but the
+   * copies of the arrays is left to do at runtime.
+   * @param other The lists to copy.
+   */
+  template <std::size_t staticItemsCount, std::size_t staticOptionsCount, std::size_t staticNodesCount>
+  explicit BasicDancingCellsStructure(
+      const StaticDancingCellsStructure<Index, staticItemsCount, staticOptionsCount, staticNodesCount>& other)
+      : ITEM(other.ITEM.begin(), other.ITEM.end())
+      , SET(other.SET.begin(), other.SET.end())
+      , NODE(other.NODE.begin(), other.NODE.end())
+      , primaryItemsCount(other.primaryItemsCount)
+      , secondaryItemsCount(other.secondaryItemsCount)
+      , itemsCount(static_cast<int32_t>(staticItemsCount))
+      , optionsCount(static_cast<int32_t>(staticOptionsCount))
+      , nodeOptionIndices(other.nodeOptionIndices.begin(), other.nodeOptionIndices.end()) {}
+
+  /** Constructor that converts a structure to another index type.
+   * @param other The structure to convert, which must fit, see fits().
+   */
+  template <std::signed_integral OtherIndex>
+  explicit BasicDancingCellsStructure(const BasicDancingCellsStructure<OtherIndex>& other) {
+    assign(other);
+  }
+
+  /** Computes whether every index, size and color of a structure can be stored as an Index.
+   * @param other The structure.
+   * @return Whether the structure fits.
+   */
+  template <std::signed_integral OtherIndex>
+  static bool fits(const BasicDancingCellsStructure<OtherIndex>& other) {
+    if constexpr (sizeof(OtherIndex) <= sizeof(Index)) {
+      return true;
+    }
+    // Indices point into SET and NODE, and sizes are smaller than SET
+    std::size_t largestValue = std::max(other.SET.size(), other.NODE.size());
+    for (const auto& node : other.NODE) {
+      largestValue = std::max(largestValue, static_cast<std::size_t>(std::abs(node.color)));
+    }
+    return largestValue <= static_cast<std::size_t>(std::numeric_limits<Index>::max());
+  }
+
+  /** Replaces the contents of the structure by a converted copy of another one, reusing the memory of the lists
+   * wherever it is large enough.
+   * @param other The structure to convert, which must fit, see fits().
+   */
+  template <std::signed_integral OtherIndex>
+  void assign(const BasicDancingCellsStructure<OtherIndex>& other) {
+    if (!fits(other)) {
+      throw std::runtime_error(std::string("The structure does not fit in the index type"));
+    }
+    ITEM.assign(other.ITEM.begin(), other.ITEM.end());
+    SET.assign(other.SET.begin(), other.SET.end());
+    NODE.resize(other.NODE.size());
+    std::ranges::transform(other.NODE, NODE.begin(), [](const BasicDancingCellsNode<OtherIndex>& node) {
+      return BasicDancingCellsNode<Index>(node.item, node.location, node.color);
+    });
+    primaryItemsCount = other.primaryItemsCount;
+    secondaryItemsCount = other.secondaryItemsCount;
+    itemsCount = other.itemsCount;
+    optionsCount = other.optionsCount;
+    nodeOptionIndices = other.nodeOptionIndices;
+    optionsData = other.optionsData;
+  }
 
   /** This function is a helper to retrieve the ITEM index of an option.
    * It is simply an abbrevbiation for SET[x−2] for an input x.
    * @param itemIndex The index of the item in the SET array.
    * @return A reference to the where the item is in the ITEM array.
    */
-  inline int32_t& position(int32_t itemIndex) {
+  inline Index& position(int32_t itemIndex) {
     return SET[itemIndex - 2];
   };
 
@@ -40,18 +134,35 @@ public:
    * @param itemIndex The index of the item in the SET array.
    * @return A reference to how many active options there are for the particular item in the SET array.
    */
-  inline int32_t& size(int32_t itemIndex) {
+  inline Index& size(int32_t itemIndex) {
     return SET[itemIndex - 1];
   };
 
 private:
+  /** Creates the structure from the options, shared by both constructors.
+   * @tparam Options The list of options, either nested vectors or a flat layout.
+   * @param primaryItemsCount The amount of primary items.
+   * @param secondaryItemsCount The amount of secondary items.
+   * @param options The list of options.
+   */
+  template <typename Options>
+  void initialize(int32_t primaryItemsCount, int32_t secondaryItemsCount, const Options& options);
+
   /** Helper to make sure that a set of preconditions are ensured before creating the structure with some options.
+   * It goes through the options once, and measures them along the way.
+   * @tparam Options The list of options, either nested vectors or a flat layout.
    * @param options The list of options
    * @param primaryItemsCount The amount of primary items
    * @param itemsCount The toal amount of items (primary + secondary).
+   * @param nodesCount Set to the amount of elements of all options together.
+   * @param largestColor Set to the largest absolute value of the colors of all elements.
    */
-  static void
-  checkOptions(const std::vector<std::vector<XccElement>>& options, int32_t primaryItemsCount, int32_t itemsCount);
+  template <typename Options>
+  static void checkOptions(const Options& options,
+                           int32_t primaryItemsCount,
+                           int32_t itemsCount,
+                           int32_t& nodesCount,
+                           int64_t& largestColor);
 
   /** Helper to allocate the correct amount of memory necessary for the ITEM, SET, and NODE lists.
    * @param primaryCount The amount of primary items.
@@ -86,7 +197,7 @@ public:
    * SET[x-2] (pos) are valid values.
    * The set of all options that involve the k-th item appears in the SET array at index k.
    */
-  std::vector<int32_t> ITEM;
+  std::vector<Index> ITEM;
 
   /** SET is an heterogeneous list containing blocks of data. Each block is made up of three different data-pieces.
    * The first element of a block contains the index of the block's item in the ITEM list.
@@ -114,7 +225,7 @@ public:
    * In the list, A,B, and so on are the main "reference" nodes that are used when retrieving valid pos() or size() data
    * of an item.
    */
-  std::vector<int32_t> SET;
+  std::vector<Index> SET;
 
   /** NODE is also an heterogeneous array. It contains blocks of data that relate to each given options one by one.
    * Each option is separated by spacer, with a spacer at the beginning and a spacer at the end of the array.
@@ -136,7 +247,7 @@ public:
    * - the spacer before that option has location value equal to l.
    * - the spacer after that option has item value equal to -l.
    */
-  std::vector<DancingCellsNode> NODE;
+  std::vector<BasicDancingCellsNode<Index>> NODE;
 
   /// The amount of primary items
   int32_t primaryItemsCount = 0;
@@ -157,3 +268,9 @@ public:
    */
   std::vector<OptionData> optionsData;
 };
+
+/// The structure that every problem is created with, whose 32 bit indices fit every problem
+using DancingCellsStructure = BasicDancingCellsStructure<int32_t>;
+
+/// A structure with 16 bit indices, for problems that fit in it
+using CompactDancingCellsStructure = BasicDancingCellsStructure<int16_t>;
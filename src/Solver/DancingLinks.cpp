@@ -0,0 +1,350 @@
+#include "DancingLinks.hpp"
+
+#include <chrono>
+#include <limits>
+#include <unordered_map>
+
+AlgorithmC::DancingLinksSolver::DancingLinksSolver(const DancingCellsStructure& dataStructure)
+    : nodes(dataStructure.itemsCount + 1)
+    , items(dataStructure.itemsCount + 2)
+    , nodeOptionIndices(dataStructure.itemsCount + 1, -1)
+    , primaryItemsCount(dataStructure.primaryItemsCount)
+    , choices(dataStructure.primaryItemsCount) {
+  // Items are numbered from 1, such that 0 is the head of the list of primary items, and itemsCount + 1 the head of the
+  // list of secondary items. Every header starts as an empty list.
+  const int32_t itemsCount = dataStructure.itemsCount;
+  const int32_t secondaryItemsHead = itemsCount + 1;
+  for (int32_t item = 0; item <= secondaryItemsHead; item++) {
+    items[item] = {item - 1, item + 1};
+  }
+  items[0].left = primaryItemsCount;
+  items[primaryItemsCount].right = 0;
+  if (primaryItemsCount < itemsCount) {
+    items[secondaryItemsHead] = {itemsCount, primaryItemsCount + 1};
+    items[primaryItemsCount + 1].left = secondaryItemsHead;
+    items[itemsCount].right = secondaryItemsHead;
+  } else {
+    items[secondaryItemsHead] = {secondaryItemsHead, secondaryItemsHead};
+  }
+  for (int32_t item = 1; item <= itemsCount; item++) {
+    nodes[item].up = item;
+    nodes[item].down = item;
+  }
+
+  // Colors are renumbered from 1, such that negative colors can mark purified nodes
+  std::unordered_map<int32_t, int32_t> colors;
+  const auto& NODE = dataStructure.NODE;
+  int32_t lastSpacer = static_cast<int32_t>(nodes.size());
+  nodes.push_back({0, 0, 0, 0});
+  nodeOptionIndices.push_back(-1);
+  int32_t optionsCount = 0;
+  for (std::size_t nodeIndex = 1; nodeIndex < NODE.size(); nodeIndex++) {
+    const int32_t node = static_cast<int32_t>(nodes.size());
+    if (NODE[nodeIndex].item <= 0) {
+      // The option is complete, link the spacers before and after it to its first and last nodes
+      optionsCount++;
+      nodes[lastSpacer].down = node - 1;
+      nodes.push_back({-optionsCount, lastSpacer + 1, 0, 0});
+      nodeOptionIndices.push_back(-1);
+      lastSpacer = node;
+      continue;
+    }
+    // Before searching, pos() of an item is its ID
+    const int32_t item = dataStructure.SET[NODE[nodeIndex].item - 2] + 1;
+    int32_t color = 0;
+    if (item > primaryItemsCount && NODE[nodeIndex].color != XccElement::undefinedColor()) {
+      color = colors.try_emplace(NODE[nodeIndex].color, static_cast<int32_t>(colors.size()) + 1).first->second;
+    }
+    // Append the node at the bottom of the list of its item
+    const int32_t last = nodes[item].up;
+    nodes.push_back({item, last, item, color});
+    nodeOptionIndices.push_back(dataStructure.nodeOptionIndices[nodeIndex]);
+    nodes[last].down = node;
+    nodes[item].up = node;
+    nodes[item].top++;
+  }
+}
+
+void AlgorithmC::DancingLinksSolver::cover(int32_t item) {
+  for (int32_t node = nodes[item].down; node != item; node = nodes[node].down) {
+    hide(node);
+  }
+  const int32_t left = items[item].left;
+  const int32_t right = items[item].right;
+  items[left].right = right;
+  items[right].left = left;
+}
+
+void AlgorithmC::DancingLinksSolver::uncover(int32_t item) {
+  const int32_t left = items[item].left;
+  const int32_t right = items[item].right;
+  items[left].right = item;
+  items[right].left = item;
+  for (int32_t node = nodes[item].up; node != item; node = nodes[node].up) {
+    unhide(node);
+  }
+}
+
+void AlgorithmC::DancingLinksSolver::hide(int32_t node) {
+  RECORD_STATISTICS(searchStatistics.hideCallsCount++);
+  for (int32_t sibling = node + 1; sibling != node;) {
+    const Node& siblingNode = nodes[sibling];
+    if (siblingNode.top <= 0) {
+      // Spacer, go back to the first node of the option
+      sibling = siblingNode.up;
+      continue;
+    }
+    // Nodes of purified items stay in their list
+    if (siblingNode.color >= 0) {
+      nodes[siblingNode.up].down = siblingNode.down;
+      nodes[siblingNode.down].up = siblingNode.up;
+      nodes[siblingNode.top].top--;
+    }
+    sibling++;
+  }
+}
+
+void AlgorithmC::DancingLinksSolver::unhide(int32_t node) {
+  for (int32_t sibling = node - 1; sibling != node;) {
+    const Node& siblingNode = nodes[sibling];
+    if (siblingNode.top <= 0) {
+      // Spacer, go forward to the last node of the option
+      sibling = siblingNode.down;
+      continue;
+    }
+    if (siblingNode.color >= 0) {
+      nodes[siblingNode.up].down = sibling;
+      nodes[siblingNode.down].up = sibling;
+      nodes[siblingNode.top].top++;
+    }
+    sibling--;
+  }
+}
+
+void AlgorithmC::DancingLinksSolver::commit(int32_t node) {
+  if (nodes[node].color == 0) {
+    cover(nodes[node].top);
+  } else if (nodes[node].color > 0) {
+    purify(node);
+  }
+}
+
+void AlgorithmC::DancingLinksSolver::uncommit(int32_t node) {
+  if (nodes[node].color == 0) {
+    uncover(nodes[node].top);
+  } else if (nodes[node].color > 0) {
+    unpurify(node);
+  }
+}
+
+void AlgorithmC::DancingLinksSolver::purify(int32_t node) {
+  const int32_t color = nodes[node].color;
+  const int32_t item = nodes[node].top;
+  for (int32_t other = nodes[item].down; other != item; other = nodes[other].down) {
+    if (nodes[other].color != color) {
+      hide(other);
+    } else if (other != node) {
+      // The node itself keeps its color, such that uncommit() knows to unpurify
+      nodes[other].color = -1;
+    }
+  }
+}
+
+void AlgorithmC::DancingLinksSolver::unpurify(int32_t node) {
+  const int32_t color = nodes[node].color;
+  const int32_t item = nodes[node].top;
+  for (int32_t other = nodes[item].up; other != item; other = nodes[other].up) {
+    if (nodes[other].color < 0) {
+      nodes[other].color = color;
+    } else if (other != node) {
+      unhide(other);
+    }
+  }
+}
+
+template <typename Visitor>
+AlgorithmC::SearchStatus AlgorithmC::DancingLinksSolver::visitSolutions(const std::optional<int32_t>& seed,
+                                                                        Visitor&& visitor) {
+  RECORD_STATISTICS(searchStatistics.reset(choices.size() + 1));
+  randomGenerator = RandomGenerator(seed);
+  searchStatus = SearchStatus::Exhausted;
+  // Like dancing cells, a problem without primary items has no solutions
+  if (primaryItemsCount == 0) {
+    return searchStatus;
+  }
+
+  // The budget is checked every time a node of the search tree is entered, the deadline only periodically
+  constexpr int32_t nodesPerDeadlineCheck = 1024;
+  const int64_t maximumNodesCount = budget.maximumNodesCount.value_or(std::numeric_limits<int64_t>::max());
+  int64_t nodesCount = 0;
+  int32_t nodesUntilDeadlineCheck = 0;
+
+  // ALGORITHM C (Exact covering with colors), steps C2 to C8, with dancing links
+  int32_t level = 0;
+  int32_t item = 0;
+  int32_t choice = 0;
+
+EnterLevel: {
+  nodesCount++;
+  if (nodesCount > maximumNodesCount || budget.stopToken.stop_requested()) {
+    searchStatus = SearchStatus::CutOff;
+    goto Stop;
+  }
+  if (budget.deadline.has_value() && --nodesUntilDeadlineCheck <= 0) {
+    nodesUntilDeadlineCheck = nodesPerDeadlineCheck;
+    if (std::chrono::steady_clock::now() >= budget.deadline.value()) {
+      searchStatus = SearchStatus::CutOff;
+      goto Stop;
+    }
+  }
+  RECORD_STATISTICS(searchStatistics.nodesPerLevel[level]++);
+  if (items[0].right == 0) {
+    // Every primary item is covered, the options chosen on the levels above form a solution
+    RECORD_STATISTICS(searchStatistics.solutionsCount++);
+    optionIndices.resize(level);
+    for (int32_t solutionLevel = 0; solutionLevel < level; solutionLevel++) {
+      optionIndices[solutionLevel] = nodeOptionIndices[choices[solutionLevel]];
+    }
+    if (!visitor(std::span<const int32_t>(optionIndices))) {
+      searchStatus = SearchStatus::Stopped;
+      goto Stop;
+    }
+    goto LeaveLevel;
+  }
+
+  // Branch on a primary item with the fewest options left, breaking ties at random like RandomMrvPolicy
+  int32_t smallestSize = std::numeric_limits<int32_t>::max();
+  int32_t smallestSizeItemsCount = 0;
+  for (int32_t candidate = items[0].right; smallestSize > 1 && candidate != 0; candidate = items[candidate].right) {
+    const int32_t size = nodes[candidate].top;
+    if (size < smallestSize) {
+      smallestSize = size;
+      item = candidate;
+      smallestSizeItemsCount = 1;
+    } else if (size == smallestSize) {
+      smallestSizeItemsCount++;
+      if (randomGenerator.uniformFloat(0.0f, 1.0f) < (1.0f / static_cast<float>(smallestSizeItemsCount))) {
+        item = candidate;
+      }
+    }
+  }
+  cover(item);
+  choices[level] = nodes[item].down;
+}
+TryChoice: {
+  choice = choices[level];
+  if (choice == item) {
+    // Every option of the item has been tried
+    uncover(item);
+    goto LeaveLevel;
+  }
+  for (int32_t node = choice + 1; node != choice;) {
+    if (nodes[node].top <= 0) {
+      node = nodes[node].up;
+    } else {
+      commit(node);
+      node++;
+    }
+  }
+  level++;
+  goto EnterLevel;
+}
+LeaveLevel: {
+  if (level == 0) {
+    return searchStatus;
+  }
+  level--;
+  RECORD_STATISTICS(searchStatistics.backtracksCount++);
+  choice = choices[level];
+  for (int32_t node = choice - 1; node != choice;) {
+    if (nodes[node].top <= 0) {
+      node = nodes[node].down;
+    } else {
+      uncommit(node);
+      node--;
+    }
+  }
+  item = nodes[choice].top;
+  choices[level] = nodes[choice].down;
+  goto TryChoice;
+}
+Stop: {
+  // The visitor or the budget stopped the search. Undo every level, such that the next search starts from the problem
+  // as it was built.
+  while (level > 0) {
+    level--;
+    choice = choices[level];
+    for (int32_t node = choice - 1; node != choice;) {
+      if (nodes[node].top <= 0) {
+        node = nodes[node].down;
+      } else {
+        uncommit(node);
+        node--;
+      }
+    }
+    uncover(nodes[choice].top);
+  }
+  return searchStatus;
+}
+}
+
+AlgorithmC::SearchStatus AlgorithmC::DancingLinksSolver::forEachSolution(const std::optional<int32_t>& seed,
+                                                                          const SolutionVisitor& visitor) {
+  return visitSolutions(seed, visitor);
+}
+
+std::vector<XccSolution> AlgorithmC::DancingLinksSolver::findAllSolutions(const std::optional<int32_t>& seed) {
+  std::vector<XccSolution> solutions;
+  visitSolutions(seed, [&](std::span<const int32_t> solution) {
+    solutions.emplace_back(solution);
+    return true;
+  });
+  return solutions;
+}
+
+int64_t AlgorithmC::DancingLinksSolver::countSolutions(const std::optional<int32_t>& seed,
+                                                       const std::optional<int64_t>& limit) {
+  if (limit.has_value() && limit.value() <= 0) {
+    return 0;
+  }
+  int64_t solutionsCount = 0;
+  visitSolutions(seed, [&](std::span<const int32_t>) {
+    solutionsCount++;
+    return !limit.has_value() || solutionsCount < limit.value();
+  });
+  return solutionsCount;
+}
+
+std::optional<XccSolution> AlgorithmC::DancingLinksSolver::findOneSolution(const std::optional<int32_t>& seed) {
+  std::optional<XccSolution> solution;
+  visitSolutions(seed, [&](std::span<const int32_t> optionIndices) {
+    solution = XccSolution(optionIndices);
+    return false;
+  });
+  return solution;
+}
+
+std::optional<XccSolution> AlgorithmC::DancingLinksSolver::hasUniqueSolution(const std::optional<int32_t>& seed) {
+  std::optional<XccSolution> solution;
+  int64_t solutionsCount = 0;
+  visitSolutions(seed, [&](std::span<const int32_t> optionIndices) {
+    solutionsCount++;
+    if (solutionsCount == 1) {
+      solution = XccSolution(optionIndices);
+    }
+    return solutionsCount < 2;
+  });
+  return solutionsCount == 1 ? solution : std::nullopt;
+}
+
+void AlgorithmC::DancingLinksSolver::setBudget(const SearchBudget& searchBudget) {
+  budget = searchBudget;
+}
+
+AlgorithmC::SearchStatus AlgorithmC::DancingLinksSolver::status() const {
+  return searchStatus;
+}
+
+const AlgorithmC::SearchStatistics& AlgorithmC::DancingLinksSolver::statistics() const {
+  return searchStatistics;
+}
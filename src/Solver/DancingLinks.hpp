@@ -0,0 +1,177 @@
+#pragma once
+
+#include "AlgorithmC.hpp"
+#include "DancingCellsStructure.hpp"
+#include "RandomGenerator.hpp"
+#include "SearchStatistics.hpp"
+#include "XccSolution.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace AlgorithmC {
+
+/** Solver for XCC problems that runs Algorithm C on Knuth's original doubly linked representation ("dancing links"),
+ * instead of the sparse sets of dancing cells that BasicSolver works on. It exists to compare both representations on
+ * the same problems, and to pick the faster one for a given shape of problem.
+ *
+ * Every item heads a circular list of the nodes of its options. Covering an item unlinks every other option that
+ * contains it from the lists of their other items, and uncovering it links them back in the reverse order. Secondary
+ * items with colors are purified the same way. Like RandomMrvPolicy, it branches on one of the primary items with the
+ * fewest remaining options, picked at random.
+ */
+class DancingLinksSolver {
+public:
+  /** Constructor
+   * @param dataStructure The data structure representing XCC problem, as it was created. It is only read to build the
+   * linked lists, and the solver doesn't keep any reference to it.
+   */
+  explicit DancingLinksSolver(const DancingCellsStructure& dataStructure);
+
+  /** Passes every solution of the problem to the visitor as soon as it is found.
+   * @param seed The seed for the random number generator. Uses a random seed if not available.
+   * @param visitor Called with the option indices of every solution, in the order that they are found. The search
+   * stops as soon as it returns false.
+   * @return Whether all solutions were visited, the visitor stopped the search, or the search ran out of budget.
+   */
+  SearchStatus forEachSolution(const std::optional<int32_t>& seed, const SolutionVisitor& visitor);
+
+  /** Retrieves all solutions of the problem.
+   * @param seed The seed for the random number generator. Uses a random seed if not available.
+   * @return The solutions, in the order that they are found.
+   */
+  std::vector<XccSolution> findAllSolutions(const std::optional<int32_t>& seed);
+
+  /** Counts the solutions of the problem, without storing any of them.
+   * @param seed The seed for the random number generator. Uses a random seed if not available.
+   * @param limit The amount of solutions after which counting stops early. Counts all solutions if not available.
+   * @return The amount of solutions, which is at most the limit.
+   */
+  int64_t countSolutions(const std::optional<int32_t>& seed, const std::optional<int64_t>& limit);
+
+  /** Retrieves the first solution found of the problem.
+   * @param seed The seed for the random number generator. Uses a random seed if not available.
+   * @return If there's at least one, a solution of the XCC problem. Returns an empty optional otherwise.
+   */
+  std::optional<XccSolution> findOneSolution(const std::optional<int32_t>& seed);
+
+  /** Computes whether the problem has exactly one solution, stopping as soon as a second one is found.
+   * @param seed The seed for the random number generator. Uses a random seed if not available.
+   * @return If exactly one solution exists, then that solution. Otherwise an empty optional.
+   */
+  std::optional<XccSolution> hasUniqueSolution(const std::optional<int32_t>& seed);
+
+  /** Limits the work that every following search may do, like BasicSolver::setBudget().
+   * @param searchBudget The budget for every following search.
+   */
+  void setBudget(const SearchBudget& searchBudget);
+
+  /** How the last search ended.
+   * @return The status of the last search.
+   */
+  SearchStatus status() const;
+
+  /** The statistics of the last search. Only recorded if areStatisticsEnabled, otherwise every counter is zero.
+   * @return The statistics of the last search.
+   */
+  const SearchStatistics& statistics() const;
+
+private:
+  /** A node of the linked lists. The first nodes are the headers of the lists of the items, the others belong to the
+   * options, which are separated by spacers.
+   */
+  struct Node {
+    /// For a header, the amount of nodes in its list. Otherwise the item of the node, or for a spacer minus the amount
+    /// of options before it.
+    int32_t top = 0;
+    /// The previous node of the list. For a spacer, the first node of the option before it.
+    int32_t up = 0;
+    /// The next node of the list. For a spacer, the last node of the option after it.
+    int32_t down = 0;
+    /// The color of the node, zero if it has none, or -1 while its item is purified with that color
+    int32_t color = 0;
+  };
+
+  /** An item of the doubly linked list of the items that still have to be covered.
+   */
+  struct Item {
+    /// The previous item of the list
+    int32_t left = 0;
+    /// The next item of the list
+    int32_t right = 0;
+  };
+
+  /** Runs Algorithm C from the start, and reports every solution that it finds.
+   * @param seed The seed for the random number generator. Uses a random seed if not available.
+   * @param visitor Called with the option indices of every solution found. Returns whether the search should continue.
+   * @return Whether the search explored the whole tree, was stopped by the visitor, or ran out of budget.
+   */
+  template <typename Visitor>
+  SearchStatus visitSolutions(const std::optional<int32_t>& seed, Visitor&& visitor);
+
+  /** Removes an item from the list of items to cover, and hides every option that contains it.
+   * @param item The item.
+   */
+  void cover(int32_t item);
+
+  /** Reverts cover(), in the reverse order.
+   * @param item The item.
+   */
+  void uncover(int32_t item);
+
+  /** Removes the other nodes of an option from the lists of their items.
+   * @param node A node of the option.
+   */
+  void hide(int32_t node);
+
+  /** Reverts hide(), in the reverse order.
+   * @param node A node of the option.
+   */
+  void unhide(int32_t node);
+
+  /** Covers the item of a node of a chosen option, or purifies it if the node has a color.
+   * @param node The node.
+   */
+  void commit(int32_t node);
+
+  /** Reverts commit().
+   * @param node The node.
+   */
+  void uncommit(int32_t node);
+
+  /** Hides every option of the item of a node whose color differs from the node's, and marks the others.
+   * @param node The node.
+   */
+  void purify(int32_t node);
+
+  /** Reverts purify(), in the reverse order.
+   * @param node The node.
+   */
+  void unpurify(int32_t node);
+
+  /// The headers of the items, followed by the nodes of the options
+  std::vector<Node> nodes;
+  /// The list of the primary items that still have to be covered, with its head at index 0. The secondary items are in
+  /// a list of their own, with its head after the last item.
+  std::vector<Item> items;
+  /// The option index of every node
+  std::vector<int32_t> nodeOptionIndices;
+  /// The amount of primary items
+  int32_t primaryItemsCount = 0;
+  /// The node chosen on each level
+  std::vector<int32_t> choices;
+  /// Buffer in which the option indices of a solution are reported
+  std::vector<int32_t> optionIndices;
+  /// The limits of every search
+  SearchBudget budget;
+  /// How the last search ended
+  SearchStatus searchStatus = SearchStatus::Exhausted;
+  /// The statistics of the last search
+  SearchStatistics searchStatistics;
+  /// Picks items at random when multiple ones are equally good, reseeded at the start of every search
+  RandomGenerator randomGenerator = RandomGenerator(0);
+};
+
+} // namespace AlgorithmC
@@ -0,0 +1,311 @@
+#include "Preprocessing.hpp"
+
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+/** An occurrence of an item in an option.
+ */
+struct Occurrence {
+  /// The index of the option
+  int32_t optionIndex = 0;
+  /// The color of the item in the option
+  int32_t colorId = 0;
+};
+
+/** Computes whether two options that share a secondary item may both be part of a solution.
+ * @param colorId The color of the item in the first option.
+ * @param otherColorId The color of the item in the second option.
+ * @return Whether both options have the same color on the item.
+ */
+bool areColorsCompatible(int32_t colorId, int32_t otherColorId) {
+  return colorId != XccElement::undefinedColor() && colorId == otherColorId;
+}
+
+/** Runs the reductions of Preprocessing::reduceProblem() on the options, until nothing changes anymore.
+ */
+class Reducer {
+public:
+  /** Constructor
+   * @param primaryItemsCount The amount of primary items.
+   * @param secondaryItemsCount The amount of secondary items.
+   * @param options The list of options.
+   */
+  Reducer(int32_t primaryItemsCount, int32_t secondaryItemsCount, const XccOptions& options)
+      : primaryItemsCount(primaryItemsCount)
+      , secondaryItemsCount(secondaryItemsCount)
+      , options(options)
+      , occurrenceOffsets(primaryItemsCount + secondaryItemsCount + 1, 0)
+      , remainingCounts(primaryItemsCount, 0)
+      , isItemSettled(primaryItemsCount + secondaryItemsCount, false)
+      , isOptionRemoved(options.size(), false)
+      , lostCounts(primaryItemsCount, 0)
+      , conflictStamps(options.size(), 0)
+      , itemStamps(primaryItemsCount, 0) {
+    const int32_t itemsCount = primaryItemsCount + secondaryItemsCount;
+    for (std::size_t optionIndex = 0; optionIndex < options.size(); optionIndex++) {
+      for (const auto& element : options[optionIndex]) {
+        if (element.id < 0 || element.id >= itemsCount) {
+          throw std::runtime_error(std::string("Invalid item ID"));
+        }
+        occurrenceOffsets[element.id + 1]++;
+      }
+    }
+    std::partial_sum(occurrenceOffsets.begin(), occurrenceOffsets.end(), occurrenceOffsets.begin());
+    occurrences.resize(occurrenceOffsets.back());
+
+    auto nextOccurrences = std::vector<int32_t>(occurrenceOffsets.begin(), occurrenceOffsets.end() - 1);
+    for (int32_t optionIndex = 0; optionIndex < static_cast<int32_t>(options.size()); optionIndex++) {
+      bool hasPrimaryItem = false;
+      for (const auto& element : options[optionIndex]) {
+        occurrences[nextOccurrences[element.id]++] = {optionIndex, element.colorId};
+        hasPrimaryItem |= element.id < primaryItemsCount;
+      }
+      // Algorithm C never chooses an option without primary items
+      if (hasPrimaryItem) {
+        for (const auto& element : options[optionIndex]) {
+          if (element.id < primaryItemsCount) {
+            remainingCounts[element.id]++;
+          }
+        }
+      } else {
+        isOptionRemoved[optionIndex] = true;
+      }
+    }
+  }
+
+  /** Forces and removes options until nothing changes anymore.
+   * @return Whether every primary item can still be covered.
+   */
+  bool reduce() {
+    bool hasChanged = true;
+    while (hasChanged) {
+      hasChanged = false;
+      for (int32_t item = 0; item < primaryItemsCount; item++) {
+        if (isItemSettled[item]) {
+          continue;
+        }
+        if (remainingCounts[item] == 0) {
+          return false;
+        }
+        if (remainingCounts[item] == 1) {
+          force(item);
+          hasChanged = true;
+        }
+      }
+      // Looking ahead is more expensive, so only do it once forcing options doesn't change anything anymore
+      if (!hasChanged) {
+        for (int32_t optionIndex = 0; optionIndex < static_cast<int32_t>(options.size()); optionIndex++) {
+          if (!isOptionRemoved[optionIndex] && blocksSomeItem(optionIndex)) {
+            removeOption(optionIndex);
+            hasChanged = true;
+          }
+        }
+      }
+    }
+    return true;
+  }
+
+  /** Renumbers the items and options that are left.
+   * @param problem The reduced problem to fill.
+   */
+  void fill(Preprocessing::ReducedProblem& problem) const {
+    problem.forcedOptionIndices = forcedOptionIndices;
+
+    // Secondary items are only kept if a remaining option still contains them
+    std::vector<bool> isItemKept(primaryItemsCount + secondaryItemsCount, false);
+    for (int32_t optionIndex = 0; optionIndex < static_cast<int32_t>(options.size()); optionIndex++) {
+      if (!isOptionRemoved[optionIndex]) {
+        for (const auto& element : options[optionIndex]) {
+          isItemKept[element.id] = !isItemSettled[element.id];
+        }
+      }
+    }
+    std::vector<int32_t> newIds(primaryItemsCount + secondaryItemsCount, -1);
+    int32_t lastId = 0;
+    for (int32_t item = 0; item < primaryItemsCount + secondaryItemsCount; item++) {
+      if (isItemKept[item]) {
+        newIds[item] = lastId++;
+        if (item < primaryItemsCount) {
+          problem.primaryItemsCount++;
+        } else {
+          problem.secondaryItemsCount++;
+        }
+      }
+    }
+    problem.isSolved = problem.primaryItemsCount == 0;
+
+    for (int32_t optionIndex = 0; optionIndex < static_cast<int32_t>(options.size()); optionIndex++) {
+      if (isOptionRemoved[optionIndex]) {
+        continue;
+      }
+      for (const auto& element : options[optionIndex]) {
+        if (isItemKept[element.id]) {
+          problem.options.addElement(XccElement(newIds[element.id], element.colorId));
+        }
+      }
+      problem.options.finishOption();
+      problem.originalOptionIndices.push_back(optionIndex);
+    }
+  }
+
+private:
+  /** Forces the single remaining option of a primary item, and removes every option that conflicts with it.
+   * @param item The primary item.
+   */
+  void force(int32_t item) {
+    int32_t forcedOptionIndex = 0;
+    for (const auto& occurrence : itemOccurrences(item)) {
+      if (!isOptionRemoved[occurrence.optionIndex]) {
+        forcedOptionIndex = occurrence.optionIndex;
+      }
+    }
+    isOptionRemoved[forcedOptionIndex] = true;
+    forcedOptionIndices.push_back(forcedOptionIndex);
+    forEachConflict(forcedOptionIndex, [&](int32_t optionIndex) { removeOption(optionIndex); });
+    for (const auto& element : options[forcedOptionIndex]) {
+      isItemSettled[element.id] = true;
+    }
+  }
+
+  /** Computes whether choosing an option would leave some other primary item without any remaining option.
+   * @param optionIndex The index of the option.
+   * @return Whether the option cannot be part of any solution.
+   */
+  bool blocksSomeItem(int32_t optionIndex) {
+    stamp++;
+    for (const auto& element : options[optionIndex]) {
+      if (element.id < primaryItemsCount) {
+        itemStamps[element.id] = stamp;
+      }
+    }
+    // Count how many options every other primary item loses, in lostCounts of the items stamped with -stamp
+    bool isBlocking = false;
+    forEachConflict(optionIndex, [&](int32_t conflictingOptionIndex) {
+      for (const auto& element : options[conflictingOptionIndex]) {
+        if (element.id >= primaryItemsCount || itemStamps[element.id] == stamp) {
+          continue;
+        }
+        if (itemStamps[element.id] != -stamp) {
+          itemStamps[element.id] = -stamp;
+          lostCounts[element.id] = 0;
+        }
+        lostCounts[element.id]++;
+        isBlocking |= lostCounts[element.id] == remainingCounts[element.id];
+      }
+    });
+    return isBlocking;
+  }
+
+  /** Calls a function once for every remaining option that conflicts with an option.
+   * @param optionIndex The index of the option.
+   * @param function Called with the index of every conflicting option.
+   */
+  template <typename Function>
+  void forEachConflict(int32_t optionIndex, Function&& function) {
+    conflictStamp++;
+    conflictStamps[optionIndex] = conflictStamp;
+    for (const auto& element : options[optionIndex]) {
+      for (const auto& occurrence : itemOccurrences(element.id)) {
+        if (isOptionRemoved[occurrence.optionIndex] || conflictStamps[occurrence.optionIndex] == conflictStamp) {
+          continue;
+        }
+        if (element.id < primaryItemsCount || !areColorsCompatible(element.colorId, occurrence.colorId)) {
+          conflictStamps[occurrence.optionIndex] = conflictStamp;
+          function(occurrence.optionIndex);
+        }
+      }
+    }
+  }
+
+  /** The occurrences of an item in every option that contains it.
+   * @param item The item.
+   * @return The occurrences, by increasing option index.
+   */
+  std::span<const Occurrence> itemOccurrences(int32_t item) const {
+    const int32_t begin = occurrenceOffsets[item];
+    return std::span(occurrences).subspan(begin, occurrenceOffsets[item + 1] - begin);
+  }
+
+  /** Removes an option from the problem.
+   * @param optionIndex The index of the option.
+   */
+  void removeOption(int32_t optionIndex) {
+    isOptionRemoved[optionIndex] = true;
+    for (const auto& element : options[optionIndex]) {
+      if (element.id < primaryItemsCount) {
+        remainingCounts[element.id]--;
+      }
+    }
+  }
+
+  /// The amount of primary items
+  int32_t primaryItemsCount = 0;
+  /// The amount of secondary items
+  int32_t secondaryItemsCount = 0;
+  /// The options of the original problem
+  const XccOptions& options;
+  /// Where the occurrences of every item start in occurrences, followed by their total amount
+  std::vector<int32_t> occurrenceOffsets;
+  /// The occurrences of every item, grouped by item
+  std::vector<Occurrence> occurrences;
+  /// The amount of remaining options that contain every primary item
+  std::vector<int32_t> remainingCounts;
+  /// Whether every item is covered, or fixed to a color, by a forced option
+  std::vector<bool> isItemSettled;
+  /// Whether every option is removed or forced
+  std::vector<bool> isOptionRemoved;
+  /// The forced options, in the order they were forced
+  std::vector<int32_t> forcedOptionIndices;
+  /// The amount of options that every primary item loses while looking ahead
+  std::vector<int32_t> lostCounts;
+  /// The last conflict search that reached every option, to report it only once per search
+  std::vector<int32_t> conflictStamps;
+  /// The current conflict search
+  int32_t conflictStamp = 0;
+  /// The last lookahead that every primary item was part of: positive if it is in the option, negative otherwise
+  std::vector<int32_t> itemStamps;
+  /// The current lookahead
+  int32_t stamp = 0;
+};
+
+} // namespace
+
+DancingCellsStructure Preprocessing::ReducedProblem::createStructure() const {
+  if (isInfeasible || isSolved) {
+    return DancingCellsStructure(0, 0, {});
+  }
+  return DancingCellsStructure(primaryItemsCount, secondaryItemsCount, options.elements(), options.offsets());
+}
+
+XccSolution Preprocessing::ReducedProblem::toOriginalSolution(std::span<const int32_t> optionIndices) const {
+  std::vector<int32_t> solution = forcedOptionIndices;
+  for (const auto optionIndex : optionIndices) {
+    solution.push_back(originalOptionIndices[optionIndex]);
+  }
+  return XccSolution(solution);
+}
+
+Preprocessing::ReducedProblem
+Preprocessing::reduceProblem(int32_t primaryItemsCount, int32_t secondaryItemsCount, const XccOptions& options) {
+  ReducedProblem problem;
+  if (primaryItemsCount <= 0 || options.empty()) {
+    problem.primaryItemsCount = primaryItemsCount;
+    problem.secondaryItemsCount = secondaryItemsCount;
+    problem.options = XccOptions(options);
+    problem.originalOptionIndices.resize(options.size());
+    std::iota(problem.originalOptionIndices.begin(), problem.originalOptionIndices.end(), 0);
+    return problem;
+  }
+
+  Reducer reducer(primaryItemsCount, secondaryItemsCount, options);
+  if (!reducer.reduce()) {
+    problem.isInfeasible = true;
+    return problem;
+  }
+  reducer.fill(problem);
+  return problem;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "DancingCellsStructure.hpp"
+#include "XccElement.hpp"
+#include "XccOptions.hpp"
+#include "XccSolution.hpp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Preprocessing {
+
+/** An XCC problem after the reductions of reduceProblem(), along with what is needed to map its solutions back to the
+ * options of the original problem.
+ */
+struct ReducedProblem {
+  /** Creates the data structure of the reduced problem. If the problem is infeasible or already solved, the structure
+   * is empty and has no solutions, such that isInfeasible and isSolved have to be checked first.
+   * @return The data structure representing the reduced XCC problem.
+   */
+  DancingCellsStructure createStructure() const;
+
+  /** Maps a solution of the reduced problem back to a solution of the original problem.
+   * @param optionIndices The indices of the options of a solution of the reduced problem, or none if isSolved.
+   * @return The forced options along with the original indices of the options of the solution.
+   */
+  XccSolution toOriginalSolution(std::span<const int32_t> optionIndices) const;
+
+  /// Whether some primary item cannot be covered, in which case the original problem has no solutions
+  bool isInfeasible = false;
+  /// Whether the forced options alone cover every primary item, in which case they are the only solution
+  bool isSolved = false;
+  /// The amount of primary items that are left to cover, renumbered from 0 in their original order
+  int32_t primaryItemsCount = 0;
+  /// The amount of secondary items that remaining options still contain, renumbered after the primary items
+  int32_t secondaryItemsCount = 0;
+  /// The remaining options, with the renumbered items. Secondary items already fixed by forced options are dropped.
+  XccOptions options;
+  /// The index in the original problem of every remaining option
+  std::vector<int32_t> originalOptionIndices;
+  /// The indices in the original problem of the options that every solution contains, in the order they were forced
+  std::vector<int32_t> forcedOptionIndices;
+};
+
+/** Shrinks an XCC problem before searching it, in the spirit of Knuth's SSXCC preprocessor. Until nothing changes
+ * anymore, it forces the option of every primary item with a single remaining option, and removes the options that
+ * conflict with forced ones. Two options conflict when they share a primary item, or a secondary item without having
+ * the same color on it. Once nothing is forced anymore, it removes every option after which some other primary item
+ * would have no remaining option. The solutions of the reduced problem map one to one to those of the original one.
+ * @param primaryItemsCount The amount of primary items, see DancingCellsStructure.
+ * @param secondaryItemsCount The amount of secondary items, see DancingCellsStructure.
+ * @param options The list of options, with sorted item IDs, see DancingCellsStructure. Nested options are flattened.
+ * @return The reduced problem. A problem without any primary item or option is kept as it is.
+ */
+ReducedProblem reduceProblem(int32_t primaryItemsCount, int32_t secondaryItemsCount, const XccOptions& options);
+
+} // namespace Preprocessing
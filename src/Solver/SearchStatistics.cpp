@@ -0,0 +1,16 @@
+#include "SearchStatistics.hpp"
+
+#include <numeric>
+
+void AlgorithmC::SearchStatistics::reset(std::size_t levelsCount) {
+  nodesPerLevel.assign(levelsCount, 0);
+  solutionsCount = 0;
+  abortsCount = 0;
+  backtracksCount = 0;
+  hideCallsCount = 0;
+  mems = 0;
+}
+
+int64_t AlgorithmC::SearchStatistics::nodesCount() const {
+  return std::accumulate(nodesPerLevel.begin(), nodesPerLevel.end(), int64_t{0});
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/** Records search statistics, only when they are enabled. Otherwise the statement is not compiled at all.
+ */
+#ifdef SOLVER_STATISTICS
+#define RECORD_STATISTICS(STATEMENT) STATEMENT
+#else
+#define RECORD_STATISTICS(STATEMENT)
+#endif
+
+namespace AlgorithmC {
+
+/** Counters that describe how much work a search did, to compare searches independently of the hardware.
+ * They are only recorded when the project is configured with the solver_statistics option, which defines
+ * SOLVER_STATISTICS. Otherwise they are never touched and stay zero, so the search pays nothing for them.
+ */
+struct SearchStatistics {
+  /** Clears all counters.
+   * @param levelsCount The amount of levels that the search can reach.
+   */
+  void reset(std::size_t levelsCount);
+
+  /** The total amount of nodes of the search tree that were entered.
+   * @return The sum of the nodes of every level.
+   */
+  int64_t nodesCount() const;
+
+  /// The amount of nodes of the search tree entered on each level
+  std::vector<int64_t> nodesPerLevel;
+  /// The amount of solutions found
+  int64_t solutionsCount = 0;
+  /// The amount of options that were tried, but left a primary item without any option to cover it
+  int64_t abortsCount = 0;
+  /// The amount of times the search went back up one level
+  int64_t backtracksCount = 0;
+  /// The amount of calls to hide()
+  int64_t hideCallsCount = 0;
+  /// The amount of reads and writes to the ITEM, SET and NODE lists, following Knuth's accounting of "mems" in SSXCC
+  int64_t mems = 0;
+};
+
+/// Whether searches record their statistics in this build
+#ifdef SOLVER_STATISTICS
+constexpr bool areStatisticsEnabled = true;
+#else
+constexpr bool areStatisticsEnabled = false;
+#endif
+
+} // namespace AlgorithmC
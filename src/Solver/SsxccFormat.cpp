@@ -0,0 +1,193 @@
+#include "SsxccFormat.hpp"
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+
+/** Splits a line into its whitespace separated words.
+ * @param line The line.
+ * @return The words.
+ */
+std::vector<std::string> splitWords(const std::string& line) {
+  std::vector<std::string> words;
+  std::istringstream stream(line);
+  std::string word;
+  while (stream >> word) {
+    words.push_back(word);
+  }
+  return words;
+}
+
+/** Computes whether a line holds nothing but a comment or whitespace.
+ * @param line The line.
+ * @return Whether the line is skipped.
+ */
+bool isSkipped(const std::string& line) {
+  const auto first = line.find_first_not_of(" \t\r");
+  return first == std::string::npos || line[first] == '|';
+}
+
+/** Computes whether a word is a valid name of an item or a color.
+ * @param name The word.
+ * @return Whether it is a valid name.
+ */
+bool isValidName(const std::string& name) {
+  return !name.empty() && name.find_first_of(":|") == std::string::npos;
+}
+
+/** Creates the error of a line that is not valid.
+ * @param lineNumber The 1-based number of the line.
+ * @param message What is wrong with it.
+ * @return The error.
+ */
+std::runtime_error lineError(int64_t lineNumber, const std::string& message) {
+  return std::runtime_error("Line " + std::to_string(lineNumber) + ": " + message);
+}
+
+} // namespace
+
+DancingCellsStructure SsxccFormat::Problem::createStructure() const {
+  return DancingCellsStructure(primaryItemsCount, secondaryItemsCount, options.elements(), options.offsets());
+}
+
+SsxccFormat::Problem SsxccFormat::read(std::istream& input) {
+  Problem problem;
+  std::unordered_map<std::string, int32_t> itemIds;
+  std::unordered_map<std::string, int32_t> colorIds;
+  bool hasItems = false;
+  int64_t lineNumber = 0;
+  std::string line;
+  std::vector<std::pair<int32_t, int32_t>> option; // The ID and color of every item of the option
+  while (std::getline(input, line)) {
+    lineNumber++;
+    if (isSkipped(line)) {
+      continue;
+    }
+
+    // The first line names the items
+    if (!hasItems) {
+      hasItems = true;
+      bool isSecondary = false;
+      for (const auto& word : splitWords(line)) {
+        if (word == "|" && !isSecondary) {
+          isSecondary = true;
+          continue;
+        }
+        if (!isValidName(word)) {
+          throw lineError(lineNumber, "Invalid item name '" + word + "'");
+        }
+        if (!itemIds.emplace(word, static_cast<int32_t>(problem.itemNames.size())).second) {
+          throw lineError(lineNumber, "Duplicate item '" + word + "'");
+        }
+        problem.itemNames.push_back(word);
+        (isSecondary ? problem.secondaryItemsCount : problem.primaryItemsCount)++;
+      }
+      if (problem.primaryItemsCount == 0) {
+        throw lineError(lineNumber, "No primary items");
+      }
+      continue;
+    }
+
+    // Every other line is an option
+    option.clear();
+    for (const auto& word : splitWords(line)) {
+      const auto colon = word.find(':');
+      const auto name = word.substr(0, colon);
+      const auto found = itemIds.find(name);
+      if (found == itemIds.end()) {
+        throw lineError(lineNumber, "Unknown item '" + name + "'");
+      }
+      int32_t colorId = XccElement::undefinedColor();
+      if (colon != std::string::npos) {
+        const auto colorName = word.substr(colon + 1);
+        if (found->second < problem.primaryItemsCount) {
+          throw lineError(lineNumber, "Primary item '" + name + "' has a color");
+        }
+        if (!isValidName(colorName)) {
+          throw lineError(lineNumber, "Invalid color name '" + colorName + "'");
+        }
+        const auto [color, isNew] = colorIds.emplace(colorName, static_cast<int32_t>(problem.colorNames.size()) + 1);
+        if (isNew) {
+          problem.colorNames.push_back(colorName);
+        }
+        colorId = color->second;
+      }
+      option.emplace_back(found->second, colorId);
+    }
+    std::ranges::sort(option);
+    if (std::ranges::adjacent_find(option, {}, &std::pair<int32_t, int32_t>::first) != option.end()) {
+      throw lineError(lineNumber, "An item appears twice in the option");
+    }
+    for (const auto& [id, colorId] : option) {
+      problem.options.addElement(XccElement(id, colorId));
+    }
+    problem.options.finishOption();
+  }
+  if (!hasItems) {
+    throw lineError(lineNumber, "No items");
+  }
+  return problem;
+}
+
+void SsxccFormat::write(std::ostream& output, const Problem& problem) {
+  for (int32_t item = 0; item < static_cast<int32_t>(problem.itemNames.size()); item++) {
+    if (item == problem.primaryItemsCount) {
+      output << " |";
+    }
+    output << (item > 0 ? " " : "") << problem.itemNames[item];
+  }
+  output << '\n';
+  for (std::size_t optionIndex = 0; optionIndex < problem.options.size(); optionIndex++) {
+    const auto option = problem.options[optionIndex];
+    if (option.empty()) {
+      throw std::runtime_error(std::string("Empty options cannot be written"));
+    }
+    for (std::size_t index = 0; index < option.size(); index++) {
+      output << (index > 0 ? " " : "") << problem.itemNames[option[index].id];
+      if (option[index].colorId != XccElement::undefinedColor()) {
+        output << ':' << problem.colorNames[option[index].colorId - 1];
+      }
+    }
+    output << '\n';
+  }
+}
+
+SsxccFormat::Problem SsxccFormat::fromStructure(const DancingCellsStructure& structure) {
+  Problem problem;
+  problem.primaryItemsCount = structure.primaryItemsCount;
+  problem.secondaryItemsCount = structure.secondaryItemsCount;
+  for (int32_t item = 0; item < structure.itemsCount; item++) {
+    problem.itemNames.push_back("i" + std::to_string(item));
+  }
+
+  // Colors get consecutive IDs in the problem, ordered by their ID in the structure
+  std::map<int32_t, int32_t> colorIds;
+  for (const auto& node : structure.NODE) {
+    if (node.item > 0 && node.color != XccElement::undefinedColor()) {
+      colorIds.emplace(node.color, 0);
+    }
+  }
+  for (auto& [color, colorId] : colorIds) {
+    problem.colorNames.push_back("c" + std::to_string(color));
+    colorId = static_cast<int32_t>(problem.colorNames.size());
+  }
+
+  // Every option lies between two spacers, and pos() of every item in SET still holds its ID
+  for (int32_t nodeIndex = 1; nodeIndex < static_cast<int32_t>(structure.NODE.size()); nodeIndex++) {
+    const auto& node = structure.NODE[nodeIndex];
+    if (node.item <= 0) {
+      if (node.item < 0) {
+        problem.options.finishOption();
+      }
+      continue;
+    }
+    const int32_t colorId = node.color == XccElement::undefinedColor() ? node.color : colorIds.at(node.color);
+    problem.options.addElement(XccElement(structure.SET[node.item - 2], colorId));
+  }
+  return problem;
+}
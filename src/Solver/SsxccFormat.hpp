@@ -0,0 +1,68 @@
+#pragma once
+#include "DancingCellsStructure.hpp"
+#include "XccOptions.hpp"
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/** Reads and writes XCC problems in the text format of Knuth's DLX and SSXCC programs.
+ *
+ * Lines that start with '|' are comments, and empty lines are ignored. The first other line names the items: the
+ * primary items, then optionally '|' followed by the secondary items. Every following line is an option, which lists
+ * the names of its items in any order. A secondary item may be followed by ':' and the name of its color. Names are
+ * made of any characters except whitespace, ':' and '|'. For instance:
+ *
+ *   | A simple example of color controls
+ *   p q r | x y
+ *   p q x y:A
+ *   p r x:A y
+ *   p x:B
+ *   q x:A
+ *   r y:B
+ */
+namespace SsxccFormat {
+
+/** An XCC problem together with the names of its items and colors.
+ */
+struct Problem {
+  /** Creates the structure of the problem.
+   * @return The structure, see DancingCellsStructure.
+   */
+  DancingCellsStructure createStructure() const;
+
+  /// The names of the primary items, followed by the names of the secondary items
+  std::vector<std::string> itemNames;
+  /// The names of the colors, the color with ID c is named colorNames[c - 1]
+  std::vector<std::string> colorNames;
+  /// The amount of primary items
+  int32_t primaryItemsCount = 0;
+  /// The amount of secondary items
+  int32_t secondaryItemsCount = 0;
+  /// The options, whose item IDs are sorted
+  XccOptions options;
+};
+
+/** Reads a problem, one line after the other.
+ * @param input The text of the problem.
+ * @return The problem. Throws if the text is not a valid problem, with the number of the offending line.
+ */
+Problem read(std::istream& input);
+
+/** Writes a problem, one line after the other.
+ * @param output Where the text of the problem is written.
+ * @param problem The problem. Throws if it has an empty option, which the format cannot express.
+ */
+void write(std::ostream& output, const Problem& problem);
+
+/** Recovers the problem of a structure that no search has modified. Items are named "i" followed by their ID, and
+ * colors "c" followed by their ID in the structure. Empty options are not part of the structure, and cannot be written
+ * anyway.
+ * @param structure The structure.
+ * @return The problem.
+ */
+Problem fromStructure(const DancingCellsStructure& structure);
+
+} // namespace SsxccFormat
@@ -0,0 +1,107 @@
+#pragma once
+#include "DancingCellsNode.hpp"
+#include "XccElement.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+/** The ITEM, SET and NODE lists of a BasicDancingCellsStructure, for a problem whose size is known at compile time.
+ * The lists are std::arrays, such that they can be created in a constant expression and stored in the read-only data
+ * of the binary. A BasicDancingCellsStructure is then created from them by copying the arrays, without going through
+ * the options at all, see BasicDancingCellsStructure::BasicDancingCellsStructure().
+ * @tparam Index The integer type of the indices, see BasicDancingCellsStructure.
+ * @tparam itemsCount The total amount of items (primary + secondary).
+ * @tparam optionsCount The amount of options.
+ * @tparam nodesCount The amount of elements of all options together.
+ */
+template <std::signed_integral Index, std::size_t itemsCount, std::size_t optionsCount, std::size_t nodesCount>
+struct StaticDancingCellsStructure {
+  /** Creates the lists of the options, exactly like the constructors of BasicDancingCellsStructure do. Every element
+   * has an undefined color. Invalid options make the creation fail, which turns into a compile error when it is
+   * evaluated in a constant expression.
+   * @param primaryItemsCount The amount of primary items (for n primary items: IDs: [0, 1, ..., n-1])
+   * @param itemIds The item IDs of every option, one option after the other. Each option must contain sorted IDs.
+   * @param offsets Where every option starts in the item IDs, followed by the amount of item IDs.
+   * @return The lists.
+   */
+  static constexpr StaticDancingCellsStructure
+  create(int32_t primaryItemsCount, std::span<const int32_t> itemIds, std::span<const int32_t> offsets) {
+    if (offsets.size() != optionsCount + 1 || offsets.front() != 0 || itemIds.size() != nodesCount ||
+        offsets.back() != static_cast<int32_t>(nodesCount)) {
+      throw std::runtime_error(std::string("Invalid option offsets"));
+    }
+    if ((primaryItemsCount <= 0) != (optionsCount == 0) || primaryItemsCount > static_cast<int32_t>(itemsCount)) {
+      throw std::runtime_error(std::string("No primary items or options provided"));
+    }
+    // SET is larger than NODE, and every index and size is smaller than SET
+    if (nodesCount + 2 * itemsCount > static_cast<std::size_t>(std::numeric_limits<Index>::max())) {
+      throw std::runtime_error(std::string("The options do not fit in the index type"));
+    }
+
+    StaticDancingCellsStructure structure;
+    structure.primaryItemsCount = primaryItemsCount;
+    structure.secondaryItemsCount = static_cast<int32_t>(itemsCount) - primaryItemsCount;
+
+    // The size of every item is known up front, so every block of SET is laid out right away
+    auto itemSizes = std::array<Index, itemsCount>();
+    for (std::size_t optionIndex = 0; optionIndex < optionsCount; optionIndex++) {
+      for (int32_t offset = offsets[optionIndex]; offset < offsets[optionIndex + 1]; offset++) {
+        if (itemIds[offset] < 0 || itemIds[offset] >= static_cast<int32_t>(itemsCount) ||
+            (offset > offsets[optionIndex] && itemIds[offset] < itemIds[offset - 1])) {
+          throw std::runtime_error(std::string("Invalid item ID"));
+        }
+        itemSizes[itemIds[offset]]++;
+      }
+    }
+    Index setIndex = 2;
+    for (std::size_t item = 0; item < itemsCount; item++) {
+      if (itemSizes[item] == 0) {
+        throw std::runtime_error(std::string("An item cannot be covered with the given options"));
+      }
+      structure.ITEM[item] = setIndex;
+      structure.SET[setIndex - 2] = static_cast<Index>(item);
+      structure.SET[setIndex - 1] = itemSizes[item];
+      setIndex += 2 + itemSizes[item];
+    }
+
+    // Every node goes to the next free location in the block of its item, in the order of the options
+    auto nextLocations = structure.ITEM;
+    int32_t lastNode = 0;
+    for (std::size_t optionIndex = 0; optionIndex < optionsCount; optionIndex++) {
+      if (offsets[optionIndex] == offsets[optionIndex + 1]) {
+        continue;
+      }
+      const int32_t previousSpacerIndex = lastNode;
+      for (int32_t offset = offsets[optionIndex]; offset < offsets[optionIndex + 1]; offset++) {
+        lastNode++;
+        const Index location = nextLocations[itemIds[offset]]++;
+        structure.NODE[lastNode] = {structure.ITEM[itemIds[offset]], location, XccElement::undefinedColor()};
+        structure.SET[location] = static_cast<Index>(lastNode);
+        structure.nodeOptionIndices[lastNode] = static_cast<int32_t>(optionIndex);
+      }
+      structure.NODE[previousSpacerIndex].location = static_cast<Index>(lastNode - previousSpacerIndex);
+      lastNode++;
+      structure.NODE[lastNode].item = static_cast<Index>(previousSpacerIndex + 1 - lastNode);
+    }
+    return structure;
+  }
+
+  /// See BasicDancingCellsStructure::ITEM
+  std::array<Index, itemsCount> ITEM = {};
+  /// See BasicDancingCellsStructure::SET
+  std::array<Index, nodesCount + 2 * itemsCount> SET = {};
+  /// See BasicDancingCellsStructure::NODE
+  std::array<BasicDancingCellsNode<Index>, nodesCount + optionsCount + 1> NODE = {};
+  /// See BasicDancingCellsStructure::nodeOptionIndices
+  std::array<int32_t, nodesCount + optionsCount + 1> nodeOptionIndices = {};
+  /// The amount of primary items
+  int32_t primaryItemsCount = 0;
+  /// The amount of secondary items
+  int32_t secondaryItemsCount = 0;
+};
@@ -0,0 +1,195 @@
+#include "StructureFile.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/** Rounds a size up to the next multiple of StructureFile::sectionAlignment.
+ * @param size The size in bytes.
+ * @return The aligned size.
+ */
+std::size_t alignSection(std::size_t size) {
+  return (size + StructureFile::sectionAlignment - 1) / StructureFile::sectionAlignment *
+         StructureFile::sectionAlignment;
+}
+
+/** Where every list starts in a file, in bytes from its start.
+ */
+struct Sections {
+  /** Computes where the lists of a file start.
+   * @tparam Index The integer type of the indices.
+   * @param header The header of the file.
+   */
+  template <std::signed_integral Index>
+  static Sections create(const StructureFile::Header& header) {
+    Sections sections;
+    sections.item = sizeof(StructureFile::Header);
+    sections.set = sections.item + alignSection(header.itemLength * sizeof(Index));
+    sections.node = sections.set + alignSection(header.setLength * sizeof(Index));
+    sections.nodeOptionIndices =
+        sections.node + alignSection(header.nodeLength * sizeof(BasicDancingCellsNode<Index>));
+    sections.end = sections.nodeOptionIndices + alignSection(header.nodeLength * sizeof(int32_t));
+    return sections;
+  }
+
+  /// Where ITEM starts
+  std::size_t item = 0;
+  /// Where SET starts
+  std::size_t set = 0;
+  /// Where NODE starts
+  std::size_t node = 0;
+  /// Where nodeOptionIndices starts
+  std::size_t nodeOptionIndices = 0;
+  /// The size of the whole file
+  std::size_t end = 0;
+};
+
+/** Views the bytes of a list in a mapped file as its elements.
+ * @tparam Element The type of the elements.
+ * @param bytes The whole file.
+ * @param offset Where the list starts.
+ * @param length The amount of elements.
+ * @return The elements.
+ */
+template <typename Element>
+std::span<Element> viewSection(std::span<std::byte> bytes, std::size_t offset, uint64_t length) {
+  return {reinterpret_cast<Element*>(bytes.data() + offset), static_cast<std::size_t>(length)};
+}
+
+/** Reads the header of a file, and checks that the rest of the file matches it.
+ * @tparam Index The integer type of the indices that the file must have.
+ * @param bytes The whole file.
+ * @return The header.
+ */
+template <std::signed_integral Index>
+StructureFile::Header readHeader(std::span<const std::byte> bytes) {
+  StructureFile::Header header;
+  if (bytes.size() < sizeof(StructureFile::Header)) {
+    throw std::runtime_error(std::string("The structure file is truncated"));
+  }
+  std::memcpy(&header, bytes.data(), sizeof(StructureFile::Header));
+  if (header.magic != StructureFile::Header().magic) {
+    throw std::runtime_error(std::string("Not a structure file"));
+  }
+  if (header.version != StructureFile::version) {
+    throw std::runtime_error(std::string("Unsupported structure file version"));
+  }
+  if (header.indexWidth != sizeof(Index)) {
+    throw std::runtime_error(std::string("The structure file has another index width"));
+  }
+  if (header.primaryItemsCount < 0 || header.secondaryItemsCount < 0 || header.optionsCount < 0 ||
+      header.itemLength != static_cast<uint64_t>(header.primaryItemsCount + header.secondaryItemsCount) ||
+      std::max(header.setLength, header.nodeLength) > static_cast<uint64_t>(std::numeric_limits<Index>::max())) {
+    throw std::runtime_error(std::string("Invalid structure file header"));
+  }
+  if (Sections::create<Index>(header).end != bytes.size()) {
+    throw std::runtime_error(std::string("The structure file is truncated"));
+  }
+  if (StructureFile::computeChecksum(bytes.subspan(sizeof(StructureFile::Header))) != header.checksum) {
+    throw std::runtime_error(std::string("The structure file checksum does not match"));
+  }
+  return header;
+}
+
+} // namespace
+
+uint64_t StructureFile::computeChecksum(std::span<const std::byte> bytes) {
+  constexpr uint64_t offsetBasis = 14695981039346656037ULL;
+  constexpr uint64_t prime = 1099511628211ULL;
+  uint64_t checksum = offsetBasis;
+  for (std::size_t offset = 0; offset + sizeof(uint64_t) <= bytes.size(); offset += sizeof(uint64_t)) {
+    uint64_t word = 0;
+    std::memcpy(&word, bytes.data() + offset, sizeof(uint64_t));
+    checksum = (checksum ^ word) * prime;
+  }
+  return checksum;
+}
+
+template <std::signed_integral Index>
+bool StructureFile::write(const std::filesystem::path& path, const BasicDancingCellsStructure<Index>& structure) {
+  Header header;
+  header.indexWidth = sizeof(Index);
+  header.primaryItemsCount = structure.primaryItemsCount;
+  header.secondaryItemsCount = structure.secondaryItemsCount;
+  header.optionsCount = structure.optionsCount;
+  header.itemLength = structure.ITEM.size();
+  header.setLength = structure.SET.size();
+  header.nodeLength = structure.NODE.size();
+
+  // The padding between the lists stays zero
+  const auto sections = Sections::create<Index>(header);
+  auto bytes = std::vector<std::byte>(sections.end);
+  const auto copySection = [&](std::size_t offset, const auto& list) {
+    if (!list.empty()) {
+      std::memcpy(bytes.data() + offset, list.data(), list.size() * sizeof(list[0]));
+    }
+  };
+  copySection(sections.item, structure.ITEM);
+  copySection(sections.set, structure.SET);
+  copySection(sections.node, structure.NODE);
+  copySection(sections.nodeOptionIndices, structure.nodeOptionIndices);
+  header.checksum = computeChecksum(std::span(bytes).subspan(sizeof(Header)));
+  std::memcpy(bytes.data(), &header, sizeof(Header));
+  return FileIo::writeBytes(path, bytes);
+}
+
+template <std::signed_integral Index>
+std::optional<StructureFile::MappedStructure<Index>>
+StructureFile::MappedStructure<Index>::open(const std::filesystem::path& path) {
+  auto file = FileIo::MappedFile::open(path);
+  if (!file.has_value()) {
+    return {};
+  }
+  return MappedStructure(std::move(file.value()));
+}
+
+template <std::signed_integral Index>
+StructureFile::MappedStructure<Index>::MappedStructure(FileIo::MappedFile mappedFile)
+    : file(std::move(mappedFile)) {
+  const auto bytes = file.bytes();
+  const auto header = readHeader<Index>(bytes);
+  const auto sections = Sections::create<Index>(header);
+  ITEM = viewSection<Index>(bytes, sections.item, header.itemLength);
+  SET = viewSection<Index>(bytes, sections.set, header.setLength);
+  NODE = viewSection<BasicDancingCellsNode<Index>>(bytes, sections.node, header.nodeLength);
+  nodeOptionIndices = viewSection<int32_t>(bytes, sections.nodeOptionIndices, header.nodeLength);
+  primaryItemsCount = header.primaryItemsCount;
+  secondaryItemsCount = header.secondaryItemsCount;
+  optionsCount = header.optionsCount;
+}
+
+template <std::signed_integral Index>
+BasicDancingCellsStructure<Index> StructureFile::MappedStructure<Index>::createStructure() const {
+  auto structure = BasicDancingCellsStructure<Index>(0, 0, {});
+  structure.ITEM.assign(ITEM.begin(), ITEM.end());
+  structure.SET.assign(SET.begin(), SET.end());
+  structure.NODE.assign(NODE.begin(), NODE.end());
+  structure.nodeOptionIndices.assign(nodeOptionIndices.begin(), nodeOptionIndices.end());
+  structure.primaryItemsCount = primaryItemsCount;
+  structure.secondaryItemsCount = secondaryItemsCount;
+  structure.itemsCount = primaryItemsCount + secondaryItemsCount;
+  structure.optionsCount = optionsCount;
+  return structure;
+}
+
+template <std::signed_integral Index>
+std::optional<BasicDancingCellsStructure<Index>> StructureFile::read(const std::filesystem::path& path) {
+  const auto mappedStructure = MappedStructure<Index>::open(path);
+  if (!mappedStructure.has_value()) {
+    return {};
+  }
+  return mappedStructure->createStructure();
+}
+
+template bool StructureFile::write(const std::filesystem::path&, const BasicDancingCellsStructure<int16_t>&);
+template bool StructureFile::write(const std::filesystem::path&, const BasicDancingCellsStructure<int32_t>&);
+template class StructureFile::MappedStructure<int16_t>;
+template class StructureFile::MappedStructure<int32_t>;
+template std::optional<BasicDancingCellsStructure<int16_t>> StructureFile::read(const std::filesystem::path&);
+template std::optional<BasicDancingCellsStructure<int32_t>> StructureFile::read(const std::filesystem::path&);
@@ -0,0 +1,123 @@
+#pragma once
+#include "DancingCellsStructure.hpp"
+#include "FileIo.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+
+/** Stores a BasicDancingCellsStructure in a binary file, which is loaded back by mapping it into memory instead of
+ * creating the structure from its options again.
+ *
+ * The file starts with a Header, followed by the ITEM, SET, NODE and nodeOptionIndices lists, exactly as they are laid
+ * out in memory. Every list starts at a multiple of sectionAlignment, such that the lists of the mapped file are used
+ * in place. Numbers are stored in the byte order of the machine, the files are meant to be shared between processes on
+ * the same machine rather than between machines. BasicDancingCellsStructure::optionsData is not stored.
+ */
+namespace StructureFile {
+
+/// The version of the file format, which is increased whenever the format changes
+constexpr uint32_t version = 1;
+
+/// Every list starts at a multiple of this amount of bytes, which is the size of a cache line
+constexpr std::size_t sectionAlignment = 64;
+
+/** The start of a file, which describes the lists that follow it.
+ */
+struct Header {
+  /// Identifies the file as a structure file
+  std::array<char, 8> magic = {'K', 'u', 'X', 'c', 'c', '\0', '\0', '\0'};
+  /// The version of the file format
+  uint32_t version = StructureFile::version;
+  /// The size of an index in bytes, see BasicDancingCellsStructure
+  uint32_t indexWidth = 0;
+  /// The amount of primary items
+  int32_t primaryItemsCount = 0;
+  /// The amount of secondary items
+  int32_t secondaryItemsCount = 0;
+  /// The total amount of options
+  int32_t optionsCount = 0;
+  /// Unused, keeps the following counts aligned
+  uint32_t padding = 0;
+  /// The length of the ITEM list
+  uint64_t itemLength = 0;
+  /// The length of the SET list
+  uint64_t setLength = 0;
+  /// The length of the NODE list, which is also the length of the nodeOptionIndices list
+  uint64_t nodeLength = 0;
+  /// The checksum of everything that follows the header, see computeChecksum()
+  uint64_t checksum = 0;
+};
+static_assert(sizeof(Header) == sectionAlignment);
+
+/** Computes the checksum of the lists of a file: 64-bit FNV-1a, over 8-byte words instead of single bytes.
+ * @param bytes Everything that follows the header, whose size is a multiple of 8 bytes.
+ * @return The checksum.
+ */
+uint64_t computeChecksum(std::span<const std::byte> bytes);
+
+/** Writes a structure to a file.
+ * @param path The path of the file, which must have an extension.
+ * @param structure The structure.
+ * @return Whether the whole file was written.
+ */
+template <std::signed_integral Index>
+bool write(const std::filesystem::path& path, const BasicDancingCellsStructure<Index>& structure);
+
+/** The lists of a structure, used in place in a mapped file. The mapping is private, see FileIo::MappedFile, so that
+ * modifying the lists only copies the pages that are written to, and never changes the file.
+ * @tparam Index The integer type of the indices, which must be the one the file was written with.
+ */
+template <std::signed_integral Index>
+class MappedStructure {
+public:
+  /** Maps a file and checks its header and checksum.
+   * @param path The path of the file.
+   * @return The mapped structure. Returns an empty optional if the file does not exist or cannot be mapped. Throws if
+   * it is not a valid structure file with indices of type Index.
+   */
+  static std::optional<MappedStructure> open(const std::filesystem::path& path);
+
+  /** Creates a structure by copying the mapped lists.
+   * @return The structure.
+   */
+  BasicDancingCellsStructure<Index> createStructure() const;
+
+private:
+  /** Constructor
+   * @param file The mapped file, whose header is valid.
+   */
+  explicit MappedStructure(FileIo::MappedFile file);
+
+  /// The mapped file, which the lists point into
+  FileIo::MappedFile file;
+
+public:
+  /// See BasicDancingCellsStructure::ITEM
+  std::span<Index> ITEM;
+  /// See BasicDancingCellsStructure::SET
+  std::span<Index> SET;
+  /// See BasicDancingCellsStructure::NODE
+  std::span<BasicDancingCellsNode<Index>> NODE;
+  /// See BasicDancingCellsStructure::nodeOptionIndices
+  std::span<int32_t> nodeOptionIndices;
+  /// The amount of primary items
+  int32_t primaryItemsCount = 0;
+  /// The amount of secondary items
+  int32_t secondaryItemsCount = 0;
+  /// The total amount of options
+  int32_t optionsCount = 0;
+};
+
+/** Reads a structure from a file, by mapping it and copying its lists.
+ * @param path The path of the file.
+ * @return The structure. Returns an empty optional if the file does not exist or cannot be mapped. Throws if it is not
+ * a valid structure file with indices of type Index.
+ */
+template <std::signed_integral Index>
+std::optional<BasicDancingCellsStructure<Index>> read(const std::filesystem::path& path);
+
+} // namespace StructureFile
@@ -7,7 +7,3 @@ XccElement::XccElement(int32_t id)
 XccElement::XccElement(int32_t id, int32_t colorId)
     : id(id)
     , colorId(colorId) {}
-
-int32_t XccElement::undefinedColor() {
-  return 0;
-}
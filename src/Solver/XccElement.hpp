@@ -26,7 +26,9 @@ struct XccElement {
 
   /** The color id representing an undefined color
    */
-  static int32_t undefinedColor();
+  static constexpr int32_t undefinedColor() {
+    return 0;
+  }
 
   /** operator< overload to be able to put XccElements in ordered sets.
    * This operator considers only the id member on purpose.
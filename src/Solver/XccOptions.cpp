@@ -0,0 +1,53 @@
+#include "XccOptions.hpp"
+
+XccOptions::XccOptions(const std::vector<std::vector<XccElement>>& options) {
+  std::size_t elementsCount = 0;
+  for (const auto& option : options) {
+    elementsCount += option.size();
+  }
+  reserve(options.size(), elementsCount);
+  for (const auto& option : options) {
+    for (const auto& element : option) {
+      addElement(element);
+    }
+    finishOption();
+  }
+}
+
+void XccOptions::reserve(std::size_t optionsCount, std::size_t elementsCount) {
+  optionElements.reserve(elementsCount);
+  optionOffsets.reserve(optionsCount + 1);
+}
+
+void XccOptions::addElement(const XccElement& element) {
+  optionElements.push_back(element);
+}
+
+void XccOptions::finishOption() {
+  optionOffsets.push_back(static_cast<int32_t>(optionElements.size()));
+}
+
+std::span<const XccElement> XccOptions::operator[](std::size_t optionIndex) const {
+  const int32_t begin = optionOffsets[optionIndex];
+  return std::span<const XccElement>(optionElements).subspan(begin, optionOffsets[optionIndex + 1] - begin);
+}
+
+std::size_t XccOptions::size() const {
+  return optionOffsets.size() - 1;
+}
+
+bool XccOptions::empty() const {
+  return optionOffsets.size() == 1;
+}
+
+std::size_t XccOptions::elementsCount() const {
+  return static_cast<std::size_t>(optionOffsets.back());
+}
+
+std::span<const XccElement> XccOptions::elements() const {
+  return optionElements;
+}
+
+std::span<const int32_t> XccOptions::offsets() const {
+  return optionOffsets;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "XccElement.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/** The options of an XCC problem, stored in a compressed sparse row layout: the elements of every option one after the
+ * other in a single array, along with where every option starts in it. Building the options only grows these two
+ * arrays, instead of allocating a vector for every option.
+ *
+ * Options are built one element at a time with addElement(), and every option is completed with finishOption().
+ */
+class XccOptions {
+public:
+  /** Default constructor, creates a list without any options.
+   */
+  XccOptions() = default;
+
+  /** Constructor that flattens nested options, such that they can be passed wherever flat ones are expected.
+   * @param options The list of options, see DancingCellsStructure.
+   */
+  XccOptions(const std::vector<std::vector<XccElement>>& options);
+
+  /** Reserves memory for options, such that building them doesn't reallocate.
+   * @param optionsCount The amount of options.
+   * @param elementsCount The amount of elements of all options together.
+   */
+  void reserve(std::size_t optionsCount, std::size_t elementsCount);
+
+  /** Adds an element to the option being built.
+   * @param element The element.
+   */
+  void addElement(const XccElement& element);
+
+  /** Completes the option being built, the following elements belong to the next option.
+   */
+  void finishOption();
+
+  /** The elements of an option.
+   * @param optionIndex The index of the option.
+   * @return The elements, which are only valid until the next option is built.
+   */
+  std::span<const XccElement> operator[](std::size_t optionIndex) const;
+
+  /** The amount of completed options.
+   * @return The amount of options.
+   */
+  std::size_t size() const;
+
+  /** Whether there are no completed options.
+   * @return Whether the list is empty.
+   */
+  bool empty() const;
+
+  /** The amount of elements of all completed options together.
+   * @return The amount of elements.
+   */
+  std::size_t elementsCount() const;
+
+  /** The elements of all options, one option after the other.
+   * @return The elements, including those of the option being built.
+   */
+  std::span<const XccElement> elements() const;
+
+  /** Where every option starts in elements(), followed by where the option being built starts.
+   * @return The offsets, one more than there are completed options.
+   */
+  std::span<const int32_t> offsets() const;
+
+private:
+  /// The elements of every option, one option after the other
+  std::vector<XccElement> optionElements;
+  /// Where every option starts in optionElements, followed by where the option being built starts
+  std::vector<int32_t> optionOffsets = {0};
+};
@@ -0,0 +1,33 @@
+#include "XccSolution.hpp"
+
+#include <algorithm>
+
+XccSolution::XccSolution(std::initializer_list<int32_t> optionIndices)
+    : optionIndices(optionIndices) {
+  std::ranges::sort(this->optionIndices);
+}
+
+XccSolution::XccSolution(std::span<const int32_t> optionIndices)
+    : optionIndices(optionIndices.begin(), optionIndices.end()) {
+  std::ranges::sort(this->optionIndices);
+}
+
+bool XccSolution::contains(int32_t optionIndex) const {
+  return std::ranges::binary_search(optionIndices, optionIndex);
+}
+
+std::size_t XccSolution::size() const {
+  return optionIndices.size();
+}
+
+bool XccSolution::empty() const {
+  return optionIndices.empty();
+}
+
+std::vector<int32_t>::const_iterator XccSolution::begin() const {
+  return optionIndices.begin();
+}
+
+std::vector<int32_t>::const_iterator XccSolution::end() const {
+  return optionIndices.end();
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <vector>
+
+/** A solution of an XCC problem, i.e. the set of options that together cover every primary item exactly once.
+ * The option indices are stored sorted in a flat array, such that membership can be checked with a binary search and
+ * the options can be iterated in increasing order without any hashing.
+ */
+class XccSolution {
+public:
+  /** Default constructor, creates a solution without any options.
+   */
+  XccSolution() = default;
+
+  /** Constructor
+   * @param optionIndices The indices of the options that make up the solution, in any order.
+   */
+  XccSolution(std::initializer_list<int32_t> optionIndices);
+
+  /** Constructor
+   * @param optionIndices The indices of the options that make up the solution, in any order.
+   */
+  explicit XccSolution(std::span<const int32_t> optionIndices);
+
+  /** Checks whether an option is part of the solution.
+   * @param optionIndex The index of the option.
+   * @return Whether the option is part of the solution.
+   */
+  bool contains(int32_t optionIndex) const;
+
+  /** The amount of options in the solution.
+   * @return The amount of options.
+   */
+  std::size_t size() const;
+
+  /** Whether the solution is made of zero options.
+   * @return Whether the solution is empty.
+   */
+  bool empty() const;
+
+  /** Iterator to the smallest option index of the solution.
+   * @return The begin iterator.
+   */
+  std::vector<int32_t>::const_iterator begin() const;
+
+  /** Iterator past the largest option index of the solution.
+   * @return The end iterator.
+   */
+  std::vector<int32_t>::const_iterator end() const;
+
+  /** operator== overload, two solutions are equal when they are made of the same options.
+   * @param other The other instance of XccSolution.
+   * @return Whether both solutions are equal.
+   */
+  bool operator==(const XccSolution& other) const = default;
+
+private:
+  /// The indices of the options that make up the solution, in increasing order
+  std::vector<int32_t> optionIndices;
+};
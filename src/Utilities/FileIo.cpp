@@ -1,6 +1,11 @@
 #include "FileIo.hpp"
 
+#include <fcntl.h>
 #include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
 
 std::optional<std::string> FileIo::read(const std::filesystem::path& path) {
   if (!std::filesystem::exists(path) || !std::filesystem::is_regular_file(path)) {
@@ -29,3 +34,76 @@ bool FileIo::write(const std::filesystem::path& path, const std::string& text) {
   outfile.close();
   return true;
 }
+
+bool FileIo::writeBytes(const std::filesystem::path& path, std::span<const std::byte> bytes) {
+  if (path.extension().empty()) {
+    return false;
+  }
+
+  const auto parentPath = path.parent_path();
+  if (!std::filesystem::exists(parentPath)) {
+    const bool directoryCreated = std::filesystem::create_directories(parentPath);
+    if (!directoryCreated) {
+      return false;
+    }
+  }
+
+  std::ofstream outfile(path, std::ios::binary);
+  outfile.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+  outfile.close();
+  return outfile.good();
+}
+
+std::optional<FileIo::MappedFile> FileIo::MappedFile::open(const std::filesystem::path& path) {
+  if (!std::filesystem::exists(path) || !std::filesystem::is_regular_file(path)) {
+    return {};
+  }
+
+  const int fileDescriptor = ::open(path.c_str(), O_RDONLY);
+  if (fileDescriptor < 0) {
+    return {};
+  }
+  struct stat status {};
+  if (::fstat(fileDescriptor, &status) != 0) {
+    ::close(fileDescriptor);
+    return {};
+  }
+  const auto size = static_cast<std::size_t>(status.st_size);
+  if (size == 0) {
+    // Empty files cannot be mapped, but there is nothing to map either
+    ::close(fileDescriptor);
+    return MappedFile(nullptr, 0);
+  }
+  void* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileDescriptor, 0);
+  // The mapping stays valid after closing the file
+  ::close(fileDescriptor);
+  if (data == MAP_FAILED) {
+    return {};
+  }
+  return MappedFile(static_cast<std::byte*>(data), size);
+}
+
+FileIo::MappedFile::MappedFile(std::byte* data, std::size_t size)
+    : data(data)
+    , size(size) {}
+
+FileIo::MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data(std::exchange(other.data, nullptr))
+    , size(std::exchange(other.size, 0)) {}
+
+FileIo::MappedFile& FileIo::MappedFile::operator=(MappedFile&& other) noexcept {
+  if (this != &other) {
+    if (data != nullptr) {
+      ::munmap(data, size);
+    }
+    data = std::exchange(other.data, nullptr);
+    size = std::exchange(other.size, 0);
+  }
+  return *this;
+}
+
+FileIo::MappedFile::~MappedFile() {
+  if (data != nullptr) {
+    ::munmap(data, size);
+  }
+}
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <cstddef>
 #include <filesystem>
 #include <optional>
+#include <span>
 #include <string>
 
 namespace FileIo {
@@ -10,4 +12,60 @@ std::optional<std::string> read(const std::filesystem::path& path);
 
 bool write(const std::filesystem::path& path, const std::string& text);
 
+/** Writes bytes to a binary file, creating its parent directories if needed.
+ * @param path The path of the file, which must have an extension.
+ * @param bytes The contents of the file.
+ * @return Whether the whole file was written.
+ */
+bool writeBytes(const std::filesystem::path& path, std::span<const std::byte> bytes);
+
+/** A file mapped into memory. The mapping is private: the bytes can be modified, but only the pages that are written to
+ * are copied, and the changes are neither written back to the file nor seen by other processes.
+ */
+class MappedFile {
+public:
+  /** Maps a whole file into memory.
+   * @param path The path of the file.
+   * @return The mapped file. Returns an empty optional if it is not a regular file, or cannot be mapped.
+   */
+  static std::optional<MappedFile> open(const std::filesystem::path& path);
+
+  /** Move constructor, the other file is left unmapped.
+   * @param other The file to move.
+   */
+  MappedFile(MappedFile&& other) noexcept;
+
+  /** Move assignment, the other file is left unmapped.
+   * @param other The file to move.
+   * @return This file.
+   */
+  MappedFile& operator=(MappedFile&& other) noexcept;
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /** Destructor, unmaps the file.
+   */
+  ~MappedFile();
+
+  /** The contents of the file.
+   * @return The bytes, which stay valid for as long as the file is mapped.
+   */
+  std::span<std::byte> bytes() const {
+    return {data, size};
+  }
+
+private:
+  /** Constructor
+   * @param data The start of the mapping.
+   * @param size The size of the file.
+   */
+  MappedFile(std::byte* data, std::size_t size);
+
+  /// The start of the mapping, or nullptr if nothing is mapped
+  std::byte* data = nullptr;
+  /// The size of the file
+  std::size_t size = 0;
+};
+
 } // namespace FileIo
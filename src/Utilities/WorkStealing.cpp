@@ -0,0 +1,108 @@
+#include "WorkStealing.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/** The queue of tasks owned by a single worker. The owner pops from the front, thieves pop from the back.
+ */
+struct TaskQueue {
+  /// Guards the tasks
+  std::mutex mutex;
+  /// The indices of the tasks that still need to run
+  std::deque<std::size_t> tasks;
+};
+
+/** Pops the next task from a queue.
+ * @param queue The queue to pop from
+ * @param fromFront Whether to pop from the front (owner) or from the back (thief)
+ * @return The index of the task, if the queue was not empty
+ */
+std::optional<std::size_t> popTask(TaskQueue& queue, bool fromFront) {
+  std::scoped_lock lock(queue.mutex);
+  if (queue.tasks.empty()) {
+    return {};
+  }
+  std::size_t task = 0;
+  if (fromFront) {
+    task = queue.tasks.front();
+    queue.tasks.pop_front();
+  } else {
+    task = queue.tasks.back();
+    queue.tasks.pop_back();
+  }
+  return task;
+}
+
+} // namespace
+
+int32_t WorkStealing::resolveThreadsCount(const std::optional<int32_t>& threadsCount) {
+  if (threadsCount.has_value()) {
+    return std::max(threadsCount.value(), 1);
+  }
+  return std::max(static_cast<int32_t>(std::thread::hardware_concurrency()), 1);
+}
+
+void WorkStealing::run(std::size_t tasksCount, int32_t threadsCount, const std::function<void(std::size_t)>& task) {
+  run(tasksCount, threadsCount, [&](std::size_t taskIndex, std::size_t) { task(taskIndex); });
+}
+
+void WorkStealing::run(std::size_t tasksCount,
+                       int32_t threadsCount,
+                       const std::function<void(std::size_t, std::size_t)>& task) {
+  const std::size_t workersCount = std::min(static_cast<std::size_t>(std::max(threadsCount, 1)), tasksCount);
+  if (workersCount <= 1) {
+    for (std::size_t taskIndex = 0; taskIndex < tasksCount; taskIndex++) {
+      task(taskIndex, 0);
+    }
+    return;
+  }
+
+  // Distribute the tasks in contiguous blocks, such that neighboring tasks start out on the same worker
+  std::vector<TaskQueue> queues(workersCount);
+  for (std::size_t taskIndex = 0; taskIndex < tasksCount; taskIndex++) {
+    queues[taskIndex * workersCount / tasksCount].tasks.push_back(taskIndex);
+  }
+
+  std::mutex exceptionMutex;
+  std::exception_ptr firstException;
+
+  const auto work = [&](std::size_t workerIndex) {
+    while (true) {
+      auto taskIndex = popTask(queues[workerIndex], true);
+      // Own queue is empty: try stealing from the other workers, starting with the next one
+      for (std::size_t offset = 1; !taskIndex.has_value() && offset < workersCount; offset++) {
+        taskIndex = popTask(queues[(workerIndex + offset) % workersCount], false);
+      }
+      if (!taskIndex.has_value()) {
+        // No new tasks are ever added, so every queue is empty for good
+        return;
+      }
+      try {
+        task(taskIndex.value(), workerIndex);
+      } catch (...) {
+        std::scoped_lock lock(exceptionMutex);
+        if (!firstException) {
+          firstException = std::current_exception();
+        }
+      }
+    }
+  };
+
+  {
+    std::vector<std::jthread> workers;
+    workers.reserve(workersCount);
+    for (std::size_t workerIndex = 0; workerIndex < workersCount; workerIndex++) {
+      workers.emplace_back(work, workerIndex);
+    }
+  } // Workers are joined here
+
+  if (firstException) {
+    std::rethrow_exception(firstException);
+  }
+}
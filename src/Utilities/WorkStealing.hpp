@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+
+namespace WorkStealing {
+
+/** Computes how many worker threads should be used.
+ * @param threadsCount The requested amount of threads. Uses all available hardware threads if not available.
+ * @return A strictly positive amount of threads.
+ */
+int32_t resolveThreadsCount(const std::optional<int32_t>& threadsCount);
+
+/** Runs a set of independent tasks on a pool of worker threads.
+ * Every worker starts with a contiguous block of tasks in its own queue, which it consumes from the front. As soon as
+ * its queue is empty, it steals tasks from the back of the other workers' queues. Returns once all tasks are done.
+ * If any task throws, the first exception thrown is rethrown in the calling thread after all workers have finished.
+ * @param tasksCount The amount of tasks, they are identified by the indices [0, tasksCount).
+ * @param threadsCount The amount of worker threads to use. With a single thread, all tasks run on the calling thread.
+ * @param task The function that runs a single task, given its index.
+ */
+void run(std::size_t tasksCount, int32_t threadsCount, const std::function<void(std::size_t)>& task);
+
+/** Runs a set of independent tasks on a pool of worker threads, see run(). Every task is also told which worker runs
+ * it, such that the workers can keep state between their tasks without sharing it.
+ * @param tasksCount The amount of tasks, they are identified by the indices [0, tasksCount).
+ * @param threadsCount The amount of worker threads to use. With a single thread, all tasks run on the calling thread.
+ * @param task The function that runs a single task, given its index and the index of the worker in [0, threadsCount).
+ */
+void run(std::size_t tasksCount,
+         int32_t threadsCount,
+         const std::function<void(std::size_t, std::size_t)>& task);
+
+} // namespace WorkStealing
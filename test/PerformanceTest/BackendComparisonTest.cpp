@@ -0,0 +1,178 @@
+#include "AlgorithmC.hpp"
+#include "ConstraintType.hpp"
+#include "DancingLinks.hpp"
+#include "KuTestArguments.hpp"
+#include "Puzzle.hpp"
+
+#include <doctest.h>
+
+TEST_SUITE("Backend Comparison") {
+  const auto sudokuConstraints = ConstraintType::SUDOKU_CELL | ConstraintType::SUDOKU_COLUMN |
+                                 ConstraintType::SUDOKU_ROW | ConstraintType::SUDOKU_BOX;
+  constexpr auto sudokuSpace = PuzzleSpace{9, 9, 9};
+  constexpr auto emptyGrid = Grid<sudokuSpace>{};
+
+  // Both backends count solutions of the empty grid until they have visited the same amount of nodes of the search
+  // tree. How quickly solutions turn up depends on the order of branching, but the time spent per node only depends on
+  // the representation. The puzzles are created without restarts, except for the anti knight constraint without torus,
+  // whose grid would otherwise take much longer to complete than either search.
+  const AlgorithmC::SearchBudget budget = {.maximumNodesCount = 1'000'000};
+
+  const auto checkDancingCells = [](const std::string& name,
+                                    ConstraintType constraints,
+                                    std::optional<AlgorithmC::RestartStrategy> restartStrategy = std::nullopt) {
+    const auto puzzle = Puzzle<sudokuSpace>(
+        name, emptyGrid, constraints, KuTestArguments::seed, SymmetryBreaking::None, restartStrategy);
+    AlgorithmC::Solver solver(puzzle.structure);
+    solver.setBudget(budget);
+    solver.countSolutions(KuTestArguments::seed, {});
+    CHECK_EQ(solver.status(), AlgorithmC::SearchStatus::CutOff);
+  };
+
+  const auto checkDancingLinks = [](const std::string& name,
+                                    ConstraintType constraints,
+                                    std::optional<AlgorithmC::RestartStrategy> restartStrategy = std::nullopt) {
+    const auto puzzle = Puzzle<sudokuSpace>(
+        name, emptyGrid, constraints, KuTestArguments::seed, SymmetryBreaking::None, restartStrategy);
+    AlgorithmC::DancingLinksSolver solver(puzzle.structure);
+    solver.setBudget(budget);
+    solver.countSolutions(KuTestArguments::seed, {});
+    CHECK_EQ(solver.status(), AlgorithmC::SearchStatus::CutOff);
+  };
+
+  TEST_CASE("Backend Comparison: Classic Sudoku, Dancing Cells") {
+    checkDancingCells("Backend Comparison: Classic Sudoku, Dancing Cells", sudokuConstraints);
+  }
+
+  TEST_CASE("Backend Comparison: Classic Sudoku, Dancing Links") {
+    checkDancingLinks("Backend Comparison: Classic Sudoku, Dancing Links", sudokuConstraints);
+  }
+
+  TEST_CASE("Backend Comparison: Positive Diagonal, Dancing Cells") {
+    checkDancingCells("Backend Comparison: Positive Diagonal, Dancing Cells",
+                      sudokuConstraints | ConstraintType::POSITIVE_DIAGONAL);
+  }
+
+  TEST_CASE("Backend Comparison: Positive Diagonal, Dancing Links") {
+    checkDancingLinks("Backend Comparison: Positive Diagonal, Dancing Links",
+                      sudokuConstraints | ConstraintType::POSITIVE_DIAGONAL);
+  }
+
+  TEST_CASE("Backend Comparison: Positive Diagonal Even, Dancing Cells") {
+    checkDancingCells("Backend Comparison: Positive Diagonal Even, Dancing Cells",
+                      sudokuConstraints | ConstraintType::POSITIVE_DIAGONAL_EVEN);
+  }
+
+  TEST_CASE("Backend Comparison: Positive Diagonal Even, Dancing Links") {
+    checkDancingLinks("Backend Comparison: Positive Diagonal Even, Dancing Links",
+                      sudokuConstraints | ConstraintType::POSITIVE_DIAGONAL_EVEN);
+  }
+
+  TEST_CASE("Backend Comparison: Positive Diagonal Odd, Dancing Cells") {
+    checkDancingCells("Backend Comparison: Positive Diagonal Odd, Dancing Cells",
+                      sudokuConstraints | ConstraintType::POSITIVE_DIAGONAL_ODD);
+  }
+
+  TEST_CASE("Backend Comparison: Positive Diagonal Odd, Dancing Links") {
+    checkDancingLinks("Backend Comparison: Positive Diagonal Odd, Dancing Links",
+                      sudokuConstraints | ConstraintType::POSITIVE_DIAGONAL_ODD);
+  }
+
+  TEST_CASE("Backend Comparison: Negative Diagonal, Dancing Cells") {
+    checkDancingCells("Backend Comparison: Negative Diagonal, Dancing Cells",
+                      sudokuConstraints | ConstraintType::NEGATIVE_DIAGONAL);
+  }
+
+  TEST_CASE("Backend Comparison: Negative Diagonal, Dancing Links") {
+    checkDancingLinks("Backend Comparison: Negative Diagonal, Dancing Links",
+                      sudokuConstraints | ConstraintType::NEGATIVE_DIAGONAL);
+  }
+
+  TEST_CASE("Backend Comparison: Negative Diagonal Even, Dancing Cells") {
+    checkDancingCells("Backend Comparison: Negative Diagonal Even, Dancing Cells",
+                      sudokuConstraints | ConstraintType::NEGATIVE_DIAGONAL_EVEN);
+  }
+
+  TEST_CASE("Backend Comparison: Negative Diagonal Even, Dancing Links") {
+    checkDancingLinks("Backend Comparison: Negative Diagonal Even, Dancing Links",
+                      sudokuConstraints | ConstraintType::NEGATIVE_DIAGONAL_EVEN);
+  }
+
+  TEST_CASE("Backend Comparison: Negative Diagonal Odd, Dancing Cells") {
+    checkDancingCells("Backend Comparison: Negative Diagonal Odd, Dancing Cells",
+                      sudokuConstraints | ConstraintType::NEGATIVE_DIAGONAL_ODD);
+  }
+
+  TEST_CASE("Backend Comparison: Negative Diagonal Odd, Dancing Links") {
+    checkDancingLinks("Backend Comparison: Negative Diagonal Odd, Dancing Links",
+                      sudokuConstraints | ConstraintType::NEGATIVE_DIAGONAL_ODD);
+  }
+
+  TEST_CASE("Backend Comparison: Anti King, Dancing Cells") {
+    checkDancingCells("Backend Comparison: Anti King, Dancing Cells", sudokuConstraints | ConstraintType::KING_PATTERN);
+  }
+
+  TEST_CASE("Backend Comparison: Anti King, Dancing Links") {
+    checkDancingLinks("Backend Comparison: Anti King, Dancing Links", sudokuConstraints | ConstraintType::KING_PATTERN);
+  }
+
+  TEST_CASE("Backend Comparison: Anti King Torus, Dancing Cells") {
+    checkDancingCells("Backend Comparison: Anti King Torus, Dancing Cells",
+                      sudokuConstraints | ConstraintType::KING_TORUS_PATTERN);
+  }
+
+  TEST_CASE("Backend Comparison: Anti King Torus, Dancing Links") {
+    checkDancingLinks("Backend Comparison: Anti King Torus, Dancing Links",
+                      sudokuConstraints | ConstraintType::KING_TORUS_PATTERN);
+  }
+
+  TEST_CASE("Backend Comparison: Anti Knight, Dancing Cells") {
+    checkDancingCells("Backend Comparison: Anti Knight, Dancing Cells",
+                      sudokuConstraints | ConstraintType::KNIGHT_PATTERN,
+                      AlgorithmC::RestartStrategy{});
+  }
+
+  TEST_CASE("Backend Comparison: Anti Knight, Dancing Links") {
+    checkDancingLinks("Backend Comparison: Anti Knight, Dancing Links",
+                      sudokuConstraints | ConstraintType::KNIGHT_PATTERN,
+                      AlgorithmC::RestartStrategy{});
+  }
+
+  TEST_CASE("Backend Comparison: Anti Knight Torus, Dancing Cells") {
+    checkDancingCells("Backend Comparison: Anti Knight Torus, Dancing Cells",
+                      sudokuConstraints | ConstraintType::KNIGHT_TORUS_PATTERN);
+  }
+
+  TEST_CASE("Backend Comparison: Anti Knight Torus, Dancing Links") {
+    checkDancingLinks("Backend Comparison: Anti Knight Torus, Dancing Links",
+                      sudokuConstraints | ConstraintType::KNIGHT_TORUS_PATTERN);
+  }
+
+  TEST_CASE("Backend Comparison: Disjoint Boxes, Dancing Cells") {
+    checkDancingCells("Backend Comparison: Disjoint Boxes, Dancing Cells",
+                      sudokuConstraints | ConstraintType::DISJOINT_BOXES);
+  }
+
+  TEST_CASE("Backend Comparison: Disjoint Boxes, Dancing Links") {
+    checkDancingLinks("Backend Comparison: Disjoint Boxes, Dancing Links",
+                      sudokuConstraints | ConstraintType::DISJOINT_BOXES);
+  }
+
+  TEST_CASE("Backend Comparison: Asterisk, Dancing Cells") {
+    checkDancingCells("Backend Comparison: Asterisk, Dancing Cells", sudokuConstraints | ConstraintType::ASTERISK);
+  }
+
+  TEST_CASE("Backend Comparison: Asterisk, Dancing Links") {
+    checkDancingLinks("Backend Comparison: Asterisk, Dancing Links", sudokuConstraints | ConstraintType::ASTERISK);
+  }
+
+  TEST_CASE("Backend Comparison: Hyper Sudoku, Dancing Cells") {
+    checkDancingCells("Backend Comparison: Hyper Sudoku, Dancing Cells",
+                      sudokuConstraints | ConstraintType::HYPER_SUDOKU);
+  }
+
+  TEST_CASE("Backend Comparison: Hyper Sudoku, Dancing Links") {
+    checkDancingLinks("Backend Comparison: Hyper Sudoku, Dancing Links",
+                      sudokuConstraints | ConstraintType::HYPER_SUDOKU);
+  }
+}
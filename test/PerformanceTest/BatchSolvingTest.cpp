@@ -0,0 +1,62 @@
+#include "ConstraintType.hpp"
+#include "KuTestArguments.hpp"
+#include "Puzzle.hpp"
+#include "PuzzleBatchSolver.hpp"
+
+#include <doctest.h>
+
+TEST_SUITE("Batch Solving") {
+  const auto sudokuConstraints = ConstraintType::SUDOKU_CELL | ConstraintType::SUDOKU_COLUMN |
+                                 ConstraintType::SUDOKU_ROW | ConstraintType::SUDOKU_BOX;
+  constexpr auto sudokuSpace = PuzzleSpace{9, 9, 9};
+
+  // A classic Sudoku with 30 givens, from which most of the grid follows
+  constexpr auto givenGrid = Grid<sudokuSpace>{{
+      {5, 3, 0, 0, 7, 0, 0, 0, 0},
+      {6, 0, 0, 1, 9, 5, 0, 0, 0},
+      {0, 9, 8, 0, 0, 0, 0, 6, 0},
+      {8, 0, 0, 0, 6, 0, 0, 0, 3},
+      {4, 0, 0, 8, 0, 3, 0, 0, 1},
+      {7, 0, 0, 0, 2, 0, 0, 0, 6},
+      {0, 6, 0, 0, 0, 0, 2, 8, 0},
+      {0, 0, 0, 4, 1, 9, 0, 0, 5},
+      {0, 0, 0, 0, 8, 0, 0, 7, 9},
+  }};
+  constexpr int32_t gridsCount = 10000;
+
+  /** Creates the grids to solve, by cycling the digits of the given grid, which keeps its solution unique
+   * @return The grids
+   */
+  const auto createGrids = []() {
+    std::vector<Grid<sudokuSpace>> grids;
+    for (int32_t gridIndex = 0; gridIndex < gridsCount; gridIndex++) {
+      auto grid = givenGrid;
+      for (auto& row : grid) {
+        for (auto& digit : row) {
+          if (Digits::isValid(digit)) {
+            digit = static_cast<Digit>((digit + gridIndex) % 9 + 1);
+          }
+        }
+      }
+      grids.push_back(grid);
+    }
+    return grids;
+  };
+
+  TEST_CASE("Batch Solving: Puzzle Per Grid") {
+    for (const auto& grid : createGrids()) {
+      const auto puzzle =
+          Puzzle<sudokuSpace>("Batch Solving: Puzzle Per Grid", grid, sudokuConstraints, KuTestArguments::seed);
+      CHECK(Digits::isValid(puzzle.solution[8][8]));
+    }
+  }
+
+  TEST_CASE("Batch Solving: Batch Solver") {
+    auto batchSolver = PuzzleBatchSolver<sudokuSpace>(sudokuConstraints, KuTestArguments::seed);
+    for (const auto& grid : createGrids()) {
+      const auto solution = batchSolver.solve(grid);
+      REQUIRE(solution.has_value());
+      CHECK(Digits::isValid(solution.value()[8][8]));
+    }
+  }
+}
@@ -0,0 +1,27 @@
+#include "BitsetSolver.hpp"
+#include "ConstraintType.hpp"
+#include "FourRowsSudoku.hpp"
+#include "KuTestArguments.hpp"
+#include "Puzzle.hpp"
+
+#include <doctest.h>
+
+TEST_SUITE("Bitset Solver") {
+  const auto sudokuConstraints = ConstraintType::SUDOKU_CELL | ConstraintType::SUDOKU_COLUMN |
+                                 ConstraintType::SUDOKU_ROW | ConstraintType::SUDOKU_BOX;
+  constexpr auto sudokuSpace = PuzzleSpace{9, 9, 9};
+
+  const auto check = [](const std::string& name, const std::optional<int64_t>& limit, int64_t expectedCount) {
+    const auto puzzle = Puzzle<sudokuSpace>(name, FourRowsSudoku::grid, sudokuConstraints, KuTestArguments::seed);
+    PuzzleBitsetSolver<sudokuSpace> solver(puzzle.structure);
+    CHECK_EQ(solver.countSolutions(limit), expectedCount);
+  };
+
+  TEST_CASE("Bitset Solver: All Solutions") {
+    check("Bitset Solver: All Solutions", {}, FourRowsSudoku::solutionsCount);
+  }
+
+  TEST_CASE("Bitset Solver: With Limit") {
+    check("Bitset Solver: With Limit", 1000, 1000);
+  }
+}
@@ -0,0 +1,92 @@
+#include "AlgorithmC.hpp"
+#include "ConstraintType.hpp"
+#include "FourRowsSudoku.hpp"
+#include "KuTestArguments.hpp"
+#include "Puzzle.hpp"
+
+#include <doctest.h>
+
+TEST_SUITE("Branching Policy") {
+  const auto sudokuConstraints = ConstraintType::SUDOKU_CELL | ConstraintType::SUDOKU_COLUMN |
+                                 ConstraintType::SUDOKU_ROW | ConstraintType::SUDOKU_BOX;
+  constexpr auto sudokuSpace = PuzzleSpace{9, 9, 9};
+
+  const auto createPuzzle = [](const std::string& name) {
+    return Puzzle<sudokuSpace>(name, FourRowsSudoku::grid, sudokuConstraints, KuTestArguments::seed);
+  };
+
+  const auto check = []<AlgorithmC::BranchingPolicyConcept BranchingPolicy>(const Puzzle<sudokuSpace>& puzzle,
+                                                                            const BranchingPolicy& branchingPolicy) {
+    AlgorithmC::BasicSolver<BranchingPolicy> solver(puzzle.structure, branchingPolicy);
+    CHECK_EQ(solver.countSolutions(KuTestArguments::seed, {}), FourRowsSudoku::solutionsCount);
+  };
+
+  // A 16x16 Latin square has many more items than a Sudoku, which makes picking the item to branch on more expensive
+  constexpr auto latinSquareSpace = PuzzleSpace{16, 16, 16};
+  const auto latinSquareConstraints =
+      ConstraintType::SUDOKU_CELL | ConstraintType::SUDOKU_ROW | ConstraintType::SUDOKU_COLUMN;
+  constexpr int64_t latinSquareSolutionsLimit = 200000;
+
+  const auto checkLatinSquare = []<AlgorithmC::BranchingPolicyConcept BranchingPolicy>(
+                                    const std::string& name, const BranchingPolicy& branchingPolicy) {
+    const auto puzzle =
+        Puzzle<latinSquareSpace>(name, Grid<latinSquareSpace>{}, latinSquareConstraints, KuTestArguments::seed);
+    AlgorithmC::BasicSolver<BranchingPolicy> solver(puzzle.structure, branchingPolicy);
+    CHECK_EQ(solver.countSolutions(KuTestArguments::seed, latinSquareSolutionsLimit), latinSquareSolutionsLimit);
+  };
+
+  TEST_CASE("Branching Policy: First Minimum") {
+    check(createPuzzle("Branching Policy: First Minimum"), AlgorithmC::FirstMrvPolicy());
+  }
+
+  TEST_CASE("Branching Policy: Random Tie-Breaking") {
+    check(createPuzzle("Branching Policy: Random Tie-Breaking"), AlgorithmC::RandomMrvPolicy());
+  }
+
+  TEST_CASE("Branching Policy: Reservoir Tie-Breaking") {
+    check(createPuzzle("Branching Policy: Reservoir Tie-Breaking"), AlgorithmC::ReservoirMrvPolicy());
+  }
+
+  TEST_CASE("Branching Policy: Buckets") {
+    check(createPuzzle("Branching Policy: Buckets"), AlgorithmC::BucketMrvPolicy());
+  }
+
+  TEST_CASE("Branching Policy: Size Table") {
+    check(createPuzzle("Branching Policy: Size Table"), AlgorithmC::SizeTableMrvPolicy());
+  }
+
+  TEST_CASE("Branching Policy: Cell Items Preferred") {
+    // The cell constraint always comes first, so its items are the first primary items
+    const auto puzzle = createPuzzle("Branching Policy: Cell Items Preferred");
+    const auto cellItemsCount = static_cast<int32_t>(puzzle.constraints.front()->getPrimaryItemsAmount());
+    check(puzzle, AlgorithmC::PreferredItemsMrvPolicy(0, cellItemsCount));
+  }
+
+  TEST_CASE("Branching Policy: Box Items Preferred") {
+    // The box constraint comes last, so its items are the last primary items
+    const auto puzzle = createPuzzle("Branching Policy: Box Items Preferred");
+    const auto boxItemsCount = static_cast<int32_t>(puzzle.constraints.back()->getPrimaryItemsAmount());
+    const int32_t firstBoxItemId = puzzle.structure.primaryItemsCount - boxItemsCount;
+    check(puzzle, AlgorithmC::PreferredItemsMrvPolicy(firstBoxItemId, boxItemsCount));
+  }
+
+  TEST_CASE("Branching Policy: 16x16 First Minimum") {
+    checkLatinSquare("Branching Policy: 16x16 First Minimum", AlgorithmC::FirstMrvPolicy());
+  }
+
+  TEST_CASE("Branching Policy: 16x16 Random Tie-Breaking") {
+    checkLatinSquare("Branching Policy: 16x16 Random Tie-Breaking", AlgorithmC::RandomMrvPolicy());
+  }
+
+  TEST_CASE("Branching Policy: 16x16 Reservoir Tie-Breaking") {
+    checkLatinSquare("Branching Policy: 16x16 Reservoir Tie-Breaking", AlgorithmC::ReservoirMrvPolicy());
+  }
+
+  TEST_CASE("Branching Policy: 16x16 Buckets") {
+    checkLatinSquare("Branching Policy: 16x16 Buckets", AlgorithmC::BucketMrvPolicy());
+  }
+
+  TEST_CASE("Branching Policy: 16x16 Size Table") {
+    checkLatinSquare("Branching Policy: 16x16 Size Table", AlgorithmC::SizeTableMrvPolicy());
+  }
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Grid.hpp"
+#include "PuzzleSpace.hpp"
+
+#include <cstdint>
+
+/** A classic Sudoku of which only the first four rows are given, which leaves hundreds of thousands of solutions. Its
+ * search tree is large enough to compare the solvers, and the branching policies, by counting all of its solutions.
+ */
+namespace FourRowsSudoku {
+
+/// The grid, with the first four rows given and the other ones empty
+constexpr auto grid = Grid<PuzzleSpace{9, 9, 9}>{{
+    {5, 3, 4, 6, 7, 8, 9, 1, 2},
+    {6, 7, 2, 1, 9, 5, 3, 4, 8},
+    {1, 9, 8, 3, 4, 2, 5, 6, 7},
+    {8, 5, 9, 7, 6, 1, 4, 2, 3},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+}};
+
+/// The amount of solutions of the grid under the classic Sudoku constraints
+constexpr int64_t solutionsCount = 636960;
+
+} // namespace FourRowsSudoku
@@ -0,0 +1,48 @@
+#include "AlgorithmC.hpp"
+#include "ConstraintType.hpp"
+#include "FourRowsSudoku.hpp"
+#include "KuTestArguments.hpp"
+#include "Puzzle.hpp"
+
+#include <doctest.h>
+
+TEST_SUITE("Index Width") {
+  const auto sudokuConstraints = ConstraintType::SUDOKU_CELL | ConstraintType::SUDOKU_COLUMN |
+                                 ConstraintType::SUDOKU_ROW | ConstraintType::SUDOKU_BOX;
+  constexpr auto sudokuSpace = PuzzleSpace{9, 9, 9};
+
+  // The structure of a 16x16 Latin square is much larger, but it still fits in 16 bit indices
+  constexpr auto latinSquareSpace = PuzzleSpace{16, 16, 16};
+  const auto latinSquareConstraints =
+      ConstraintType::SUDOKU_CELL | ConstraintType::SUDOKU_ROW | ConstraintType::SUDOKU_COLUMN;
+  constexpr int64_t latinSquareSolutionsLimit = 200000;
+
+  const auto check = []<typename Solver>(const std::string& name) {
+    const auto puzzle = Puzzle<sudokuSpace>(name, FourRowsSudoku::grid, sudokuConstraints, KuTestArguments::seed);
+    Solver solver(puzzle.structure);
+    CHECK_EQ(solver.countSolutions(KuTestArguments::seed, {}), FourRowsSudoku::solutionsCount);
+  };
+
+  const auto checkLatinSquare = []<typename Solver>(const std::string& name) {
+    const auto puzzle =
+        Puzzle<latinSquareSpace>(name, Grid<latinSquareSpace>{}, latinSquareConstraints, KuTestArguments::seed);
+    Solver solver(puzzle.structure);
+    CHECK_EQ(solver.countSolutions(KuTestArguments::seed, latinSquareSolutionsLimit), latinSquareSolutionsLimit);
+  };
+
+  TEST_CASE("Index Width: 32 Bit") {
+    check.operator()<AlgorithmC::Solver>("Index Width: 32 Bit");
+  }
+
+  TEST_CASE("Index Width: 16 Bit") {
+    check.operator()<AlgorithmC::CompactSolver>("Index Width: 16 Bit");
+  }
+
+  TEST_CASE("Index Width: 16x16 32 Bit") {
+    checkLatinSquare.operator()<AlgorithmC::Solver>("Index Width: 16x16 32 Bit");
+  }
+
+  TEST_CASE("Index Width: 16x16 16 Bit") {
+    checkLatinSquare.operator()<AlgorithmC::CompactSolver>("Index Width: 16x16 16 Bit");
+  }
+}
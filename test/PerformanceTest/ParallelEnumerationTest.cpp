@@ -0,0 +1,56 @@
+#include "AlgorithmC.hpp"
+#include "ConstraintType.hpp"
+#include "KuTestArguments.hpp"
+#include "Puzzle.hpp"
+
+#include <doctest.h>
+
+TEST_SUITE("Parallel Enumeration") {
+  const auto sudokuConstraints = ConstraintType::SUDOKU_CELL | ConstraintType::SUDOKU_COLUMN |
+                                 ConstraintType::SUDOKU_ROW | ConstraintType::SUDOKU_BOX;
+  constexpr auto sudokuSpace = PuzzleSpace{9, 9, 9};
+
+  // Only the first 38 cells of a classic Sudoku are given, which leaves a large amount of solutions
+  constexpr auto lightlyCluedGrid = Grid<sudokuSpace>{{
+      {5, 3, 4, 6, 7, 8, 9, 1, 2},
+      {6, 7, 2, 1, 9, 5, 3, 4, 8},
+      {1, 9, 8, 3, 4, 2, 5, 6, 7},
+      {8, 5, 9, 7, 6, 1, 4, 2, 3},
+      {4, 2, 0, 0, 0, 0, 0, 0, 0},
+      {0, 0, 0, 0, 0, 0, 0, 0, 0},
+      {0, 0, 0, 0, 0, 0, 0, 0, 0},
+      {0, 0, 0, 0, 0, 0, 0, 0, 0},
+      {0, 0, 0, 0, 0, 0, 0, 0, 0},
+  }};
+  constexpr std::size_t solutionsCount = 66924;
+
+  const auto check = [](const std::string& name, const std::optional<int32_t>& threadsCount) {
+    const auto puzzle = Puzzle<sudokuSpace>(name, lightlyCluedGrid, sudokuConstraints, KuTestArguments::seed);
+    auto structure = puzzle.structure;
+    const auto solutions = AlgorithmC::findAllSolutionsInParallel(structure, KuTestArguments::seed, threadsCount);
+    CHECK_EQ(solutions.size(), solutionsCount);
+  };
+
+  TEST_CASE("Parallel Enumeration: Sequential") {
+    const auto puzzle = Puzzle<sudokuSpace>(
+        "Parallel Enumeration: Sequential", lightlyCluedGrid, sudokuConstraints, KuTestArguments::seed);
+    auto structure = puzzle.structure;
+    CHECK_EQ(AlgorithmC::findAllSolutions(structure, KuTestArguments::seed).size(), solutionsCount);
+  }
+
+  TEST_CASE("Parallel Enumeration: 2 Threads") {
+    check("Parallel Enumeration: 2 Threads", 2);
+  }
+
+  TEST_CASE("Parallel Enumeration: 4 Threads") {
+    check("Parallel Enumeration: 4 Threads", 4);
+  }
+
+  TEST_CASE("Parallel Enumeration: 8 Threads") {
+    check("Parallel Enumeration: 8 Threads", 8);
+  }
+
+  TEST_CASE("Parallel Enumeration: Hardware Threads") {
+    check("Parallel Enumeration: Hardware Threads", {});
+  }
+}
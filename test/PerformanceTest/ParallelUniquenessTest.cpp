@@ -0,0 +1,74 @@
+#include "AlgorithmC.hpp"
+#include "ConstraintType.hpp"
+#include "KuTestArguments.hpp"
+#include "Puzzle.hpp"
+
+#include <doctest.h>
+
+TEST_SUITE("Parallel Uniqueness") {
+  const auto latinSquareConstraints =
+      ConstraintType::SUDOKU_CELL | ConstraintType::SUDOKU_ROW | ConstraintType::SUDOKU_COLUMN;
+  constexpr auto latinSquareSpace = PuzzleSpace{16, 16, 16};
+
+  // A 16x16 Latin square from which givens were removed for as long as its solution stayed unique, such that proving
+  // uniqueness has to explore a whole search tree that is as large as possible
+  constexpr auto minimalGrid = Grid<latinSquareSpace>{{
+      {10, 6, 0, 1, 16, 3, 4, 0, 0, 0, 11, 2, 13, 0, 0, 0},
+      {0, 15, 0, 0, 0, 11, 0, 5, 8, 0, 6, 0, 3, 16, 0, 0},
+      {5, 8, 0, 0, 0, 10, 11, 9, 0, 2, 7, 14, 0, 0, 0, 0},
+      {14, 16, 0, 0, 15, 12, 0, 0, 0, 0, 0, 0, 11, 13, 0, 8},
+      {11, 0, 0, 12, 0, 0, 0, 6, 14, 7, 0, 3, 0, 8, 5, 4},
+      {0, 14, 0, 4, 13, 0, 12, 8, 0, 0, 0, 5, 0, 15, 0, 3},
+      {13, 4, 1, 16, 0, 6, 3, 0, 0, 0, 0, 0, 0, 0, 0, 15},
+      {0, 0, 0, 0, 7, 5, 0, 0, 16, 0, 2, 0, 12, 0, 10, 0},
+      {12, 0, 8, 14, 0, 0, 5, 0, 10, 3, 4, 0, 7, 0, 0, 0},
+      {0, 0, 4, 13, 1, 0, 9, 0, 0, 8, 0, 11, 5, 0, 2, 0},
+      {0, 11, 0, 10, 0, 0, 16, 13, 0, 0, 1, 0, 0, 0, 0, 12},
+      {1, 2, 15, 3, 0, 9, 0, 0, 0, 4, 0, 6, 0, 10, 13, 14},
+      {0, 0, 0, 7, 0, 0, 0, 2, 4, 15, 10, 0, 8, 0, 0, 0},
+      {0, 0, 3, 9, 0, 0, 10, 0, 0, 1, 0, 4, 2, 7, 0, 5},
+      {2, 0, 6, 0, 9, 0, 0, 12, 3, 0, 13, 7, 1, 0, 0, 11},
+      {0, 9, 11, 0, 12, 0, 0, 7, 0, 0, 8, 15, 0, 1, 6, 10},
+  }};
+  constexpr int32_t repetitionsCount = 200;
+
+  const auto check = [](const std::string& name, const std::optional<int32_t>& threadsCount) {
+    const auto puzzle = Puzzle<latinSquareSpace>(name, minimalGrid, latinSquareConstraints, KuTestArguments::seed);
+    for (int32_t repetition = 0; repetition < repetitionsCount; repetition++) {
+      const auto solution =
+          AlgorithmC::hasUniqueSolutionInParallel(puzzle.structure, KuTestArguments::seed, threadsCount);
+      CHECK(solution.has_value());
+    }
+  };
+
+  TEST_CASE("Parallel Uniqueness: Sequential") {
+    const auto puzzle = Puzzle<latinSquareSpace>(
+        "Parallel Uniqueness: Sequential", minimalGrid, latinSquareConstraints, KuTestArguments::seed);
+    for (int32_t repetition = 0; repetition < repetitionsCount; repetition++) {
+      CHECK(AlgorithmC::hasUniqueSolution(puzzle.structure, KuTestArguments::seed).has_value());
+    }
+  }
+
+  TEST_CASE("Parallel Uniqueness: 2 Threads") {
+    check("Parallel Uniqueness: 2 Threads", 2);
+  }
+
+  TEST_CASE("Parallel Uniqueness: 4 Threads") {
+    check("Parallel Uniqueness: 4 Threads", 4);
+  }
+
+  TEST_CASE("Parallel Uniqueness: 8 Threads") {
+    check("Parallel Uniqueness: 8 Threads", 8);
+  }
+
+  TEST_CASE("Parallel Uniqueness: Hardware Threads") {
+    check("Parallel Uniqueness: Hardware Threads", {});
+  }
+
+  TEST_CASE("Parallel Uniqueness: Early Exit") {
+    // Without any givens, two solutions are found right away by whichever workers get there first
+    const auto puzzle = Puzzle<latinSquareSpace>(
+        "Parallel Uniqueness: Early Exit", Grid<latinSquareSpace>{}, latinSquareConstraints, KuTestArguments::seed);
+    CHECK_EQ(AlgorithmC::hasUniqueSolutionInParallel(puzzle.structure, KuTestArguments::seed, {}), std::nullopt);
+  }
+}
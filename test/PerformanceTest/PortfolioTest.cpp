@@ -0,0 +1,42 @@
+#include "AlgorithmC.hpp"
+#include "ConstraintType.hpp"
+#include "KuTestArguments.hpp"
+#include "Puzzle.hpp"
+
+#include <doctest.h>
+
+TEST_SUITE("Portfolio") {
+  // Without givens, how long it takes to find an anti knight grid depends a lot on the seed
+  const auto antiKnightConstraints = ConstraintType::SUDOKU_CELL | ConstraintType::SUDOKU_COLUMN |
+                                     ConstraintType::SUDOKU_ROW | ConstraintType::SUDOKU_BOX |
+                                     ConstraintType::KNIGHT_PATTERN;
+  constexpr auto sudokuSpace = PuzzleSpace{9, 9, 9};
+
+  const auto check = [](const std::string& name, int32_t searchesCount, const std::optional<int32_t>& threadsCount) {
+    const auto puzzle = Puzzle<sudokuSpace>(name, Grid<sudokuSpace>{}, antiKnightConstraints, KuTestArguments::seed);
+    const auto [solution, winningSeed] =
+        AlgorithmC::findOneSolutionWithPortfolio(puzzle.structure, KuTestArguments::seed, searchesCount, threadsCount);
+    CHECK(solution.has_value());
+    CHECK(winningSeed.has_value());
+  };
+
+  TEST_CASE("Portfolio: 1 Search") {
+    check("Portfolio: 1 Search", 1, 1);
+  }
+
+  TEST_CASE("Portfolio: 2 Searches") {
+    check("Portfolio: 2 Searches", 2, 2);
+  }
+
+  TEST_CASE("Portfolio: 4 Searches") {
+    check("Portfolio: 4 Searches", 4, 4);
+  }
+
+  TEST_CASE("Portfolio: 8 Searches") {
+    check("Portfolio: 8 Searches", 8, 8);
+  }
+
+  TEST_CASE("Portfolio: 8 Searches, Hardware Threads") {
+    check("Portfolio: 8 Searches, Hardware Threads", 8, {});
+  }
+}
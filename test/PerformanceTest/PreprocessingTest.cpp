@@ -0,0 +1,62 @@
+#include "AlgorithmC.hpp"
+#include "ConstraintType.hpp"
+#include "FourRowsSudoku.hpp"
+#include "KuTestArguments.hpp"
+#include "Preprocessing.hpp"
+#include "Puzzle.hpp"
+
+#include <doctest.h>
+
+TEST_SUITE("Preprocessing") {
+  const auto sudokuConstraints = ConstraintType::SUDOKU_CELL | ConstraintType::SUDOKU_COLUMN |
+                                 ConstraintType::SUDOKU_ROW | ConstraintType::SUDOKU_BOX;
+  constexpr auto sudokuSpace = PuzzleSpace{9, 9, 9};
+
+  // A classic Sudoku with 30 givens, from which most of the grid follows
+  constexpr auto givenGrid = Grid<sudokuSpace>{{
+      {5, 3, 0, 0, 7, 0, 0, 0, 0},
+      {6, 0, 0, 1, 9, 5, 0, 0, 0},
+      {0, 9, 8, 0, 0, 0, 0, 6, 0},
+      {8, 0, 0, 0, 6, 0, 0, 0, 3},
+      {4, 0, 0, 8, 0, 3, 0, 0, 1},
+      {7, 0, 0, 0, 2, 0, 0, 0, 6},
+      {0, 6, 0, 0, 0, 0, 2, 8, 0},
+      {0, 0, 0, 4, 1, 9, 0, 0, 5},
+      {0, 0, 0, 0, 8, 0, 0, 7, 9},
+  }};
+  constexpr int32_t repetitionsCount = 1000;
+
+  TEST_CASE("Preprocessing: Uniqueness Full Structure") {
+    const auto puzzle = Puzzle<sudokuSpace>(
+        "Preprocessing: Uniqueness Full Structure", givenGrid, sudokuConstraints, KuTestArguments::seed);
+    for (int32_t repetition = 0; repetition < repetitionsCount; repetition++) {
+      CHECK(AlgorithmC::hasUniqueSolution(puzzle.createStructure(), KuTestArguments::seed).has_value());
+    }
+  }
+
+  TEST_CASE("Preprocessing: Uniqueness Reduced Problem") {
+    const auto puzzle = Puzzle<sudokuSpace>(
+        "Preprocessing: Uniqueness Reduced Problem", givenGrid, sudokuConstraints, KuTestArguments::seed);
+    for (int32_t repetition = 0; repetition < repetitionsCount; repetition++) {
+      const auto problem = puzzle.createReducedProblem();
+      CHECK((problem.isSolved ||
+             AlgorithmC::hasUniqueSolution(problem.createStructure(), KuTestArguments::seed).has_value()));
+    }
+  }
+
+  TEST_CASE("Preprocessing: Counting Full Structure") {
+    const auto puzzle = Puzzle<sudokuSpace>(
+        "Preprocessing: Counting Full Structure", FourRowsSudoku::grid, sudokuConstraints, KuTestArguments::seed);
+    CHECK_EQ(AlgorithmC::countSolutions(puzzle.createStructure(), KuTestArguments::seed, {}),
+             FourRowsSudoku::solutionsCount);
+  }
+
+  TEST_CASE("Preprocessing: Counting Reduced Problem") {
+    const auto puzzle = Puzzle<sudokuSpace>(
+        "Preprocessing: Counting Reduced Problem", FourRowsSudoku::grid, sudokuConstraints, KuTestArguments::seed);
+    const auto problem = puzzle.createReducedProblem();
+    CHECK_LT(problem.options.size(), puzzle.possibilities.size());
+    CHECK_EQ(AlgorithmC::countSolutions(problem.createStructure(), KuTestArguments::seed, {}),
+             FourRowsSudoku::solutionsCount);
+  }
+}
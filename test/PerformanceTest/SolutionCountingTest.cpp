@@ -0,0 +1,27 @@
+#include "AlgorithmC.hpp"
+#include "ConstraintType.hpp"
+#include "FourRowsSudoku.hpp"
+#include "KuTestArguments.hpp"
+#include "Puzzle.hpp"
+
+#include <doctest.h>
+
+TEST_SUITE("Solution Counting") {
+  const auto sudokuConstraints = ConstraintType::SUDOKU_CELL | ConstraintType::SUDOKU_COLUMN |
+                                 ConstraintType::SUDOKU_ROW | ConstraintType::SUDOKU_BOX;
+  constexpr auto sudokuSpace = PuzzleSpace{9, 9, 9};
+
+  const auto check = [](const std::string& name, const std::optional<int64_t>& limit, int64_t expectedCount) {
+    const auto puzzle = Puzzle<sudokuSpace>(name, FourRowsSudoku::grid, sudokuConstraints, KuTestArguments::seed);
+    auto structure = puzzle.structure;
+    CHECK_EQ(AlgorithmC::countSolutions(structure, KuTestArguments::seed, limit), expectedCount);
+  };
+
+  TEST_CASE("Solution Counting: All Solutions") {
+    check("Solution Counting: All Solutions", {}, FourRowsSudoku::solutionsCount);
+  }
+
+  TEST_CASE("Solution Counting: With Limit") {
+    check("Solution Counting: With Limit", 1000, 1000);
+  }
+}
@@ -0,0 +1,71 @@
+#include "CellConstraint.hpp"
+#include "ConstraintType.hpp"
+#include "Exact3x3BoxesConstraint.hpp"
+#include "ExactColumnConstraint.hpp"
+#include "ExactRowConstraint.hpp"
+#include "KuTestArguments.hpp"
+#include "Puzzle.hpp"
+#include "StaticPuzzleStructure.hpp"
+#include "StructureFile.hpp"
+#include "TemporaryDirectory.hpp"
+
+#include <doctest.h>
+
+TEST_SUITE("Structure Building") {
+  const auto latinSquareConstraints =
+      ConstraintType::SUDOKU_CELL | ConstraintType::SUDOKU_ROW | ConstraintType::SUDOKU_COLUMN;
+  constexpr int32_t repetitionsCount = 200;
+  const auto sudokuConstraints = latinSquareConstraints | ConstraintType::SUDOKU_BOX;
+  constexpr int32_t sudokuRepetitionsCount = 10000;
+
+  TEST_CASE("Structure Building: 16x16") {
+    constexpr auto latinSquareSpace = PuzzleSpace{16, 16, 16};
+    const auto puzzle =
+        Puzzle<latinSquareSpace>("Structure Building: 16x16", {}, latinSquareConstraints, KuTestArguments::seed);
+    for (int32_t repetition = 0; repetition < repetitionsCount; repetition++) {
+      CHECK_EQ(puzzle.createStructure().optionsCount, 16 * 16 * 16);
+    }
+  }
+
+  TEST_CASE("Structure Building: 25x25") {
+    constexpr auto latinSquareSpace = PuzzleSpace{25, 25, 25};
+    const auto puzzle =
+        Puzzle<latinSquareSpace>("Structure Building: 25x25", {}, latinSquareConstraints, KuTestArguments::seed);
+    for (int32_t repetition = 0; repetition < repetitionsCount; repetition++) {
+      CHECK_EQ(puzzle.createStructure().optionsCount, 25 * 25 * 25);
+    }
+  }
+
+  TEST_CASE("Structure Building: 25x25 From File") {
+    constexpr auto latinSquareSpace = PuzzleSpace{25, 25, 25};
+    const auto puzzle = Puzzle<latinSquareSpace>(
+        "Structure Building: 25x25 From File", {}, latinSquareConstraints, KuTestArguments::seed);
+    TemporaryDirectory directory;
+    const auto path = directory.path() / "structure.xcc";
+    REQUIRE(StructureFile::write(path, puzzle.structure));
+    for (int32_t repetition = 0; repetition < repetitionsCount; repetition++) {
+      CHECK_EQ(StructureFile::read<int32_t>(path).value().optionsCount, 25 * 25 * 25);
+    }
+  }
+
+  TEST_CASE("Structure Building: 9x9 Sudoku At Runtime") {
+    constexpr auto sudokuSpace = PuzzleSpace{9, 9, 9};
+    const auto puzzle = Puzzle<sudokuSpace>(
+        "Structure Building: 9x9 Sudoku At Runtime", {}, sudokuConstraints, KuTestArguments::seed);
+    for (int32_t repetition = 0; repetition < sudokuRepetitionsCount; repetition++) {
+      CHECK_EQ(puzzle.createStructure().optionsCount, 9 * 9 * 9);
+    }
+  }
+
+  TEST_CASE("Structure Building: 9x9 Sudoku At Compile Time") {
+    constexpr auto& lists = StaticPuzzleStructure::lists<int32_t,
+                                                         PuzzleSpace{9, 9, 9},
+                                                         CellConstraint,
+                                                         ExactRowConstraint,
+                                                         ExactColumnConstraint,
+                                                         Exact3x3BoxesConstraint>;
+    for (int32_t repetition = 0; repetition < sudokuRepetitionsCount; repetition++) {
+      CHECK_EQ(DancingCellsStructure(lists).optionsCount, 9 * 9 * 9);
+    }
+  }
+}
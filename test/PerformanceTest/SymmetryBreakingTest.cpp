@@ -0,0 +1,51 @@
+#include "ConstraintType.hpp"
+#include "KuTestArguments.hpp"
+#include "Puzzle.hpp"
+
+#include <doctest.h>
+
+TEST_SUITE("Symmetry Breaking") {
+  const auto latinSquareConstraints =
+      ConstraintType::SUDOKU_CELL | ConstraintType::SUDOKU_ROW | ConstraintType::SUDOKU_COLUMN;
+  constexpr auto latinSquareSpace = PuzzleSpace{5, 5, 5};
+  constexpr int64_t latinSquaresCount = 161280;
+
+  const auto sudokuConstraints = ConstraintType::SUDOKU_CELL | ConstraintType::SUDOKU_COLUMN |
+                                 ConstraintType::SUDOKU_ROW | ConstraintType::SUDOKU_BOX;
+  constexpr auto sudokuSpace = PuzzleSpace{9, 9, 9};
+  constexpr int32_t repetitionsCount = 1000;
+
+  TEST_CASE("Symmetry Breaking: Counting Without") {
+    const auto puzzle = Puzzle<latinSquareSpace>(
+        "Symmetry Breaking: Counting Without", {}, latinSquareConstraints, KuTestArguments::seed);
+    CHECK_EQ(puzzle.countSolutions(), latinSquaresCount);
+  }
+
+  TEST_CASE("Symmetry Breaking: Counting With Digit Relabeling") {
+    const auto puzzle = Puzzle<latinSquareSpace>("Symmetry Breaking: Counting With Digit Relabeling",
+                                                 {},
+                                                 latinSquareConstraints,
+                                                 KuTestArguments::seed,
+                                                 SymmetryBreaking::DigitRelabeling);
+    CHECK_EQ(puzzle.countSolutions(), latinSquaresCount);
+  }
+
+  TEST_CASE("Symmetry Breaking: Generating Without") {
+    for (int32_t repetition = 0; repetition < repetitionsCount; repetition++) {
+      const auto puzzle = Puzzle<sudokuSpace>(
+          "Symmetry Breaking: Generating Without", {}, sudokuConstraints, KuTestArguments::seed + repetition);
+      CHECK(Digits::isValid(puzzle.solution[8][8]));
+    }
+  }
+
+  TEST_CASE("Symmetry Breaking: Generating With Digit Relabeling") {
+    for (int32_t repetition = 0; repetition < repetitionsCount; repetition++) {
+      const auto puzzle = Puzzle<sudokuSpace>("Symmetry Breaking: Generating With Digit Relabeling",
+                                              {},
+                                              sudokuConstraints,
+                                              KuTestArguments::seed + repetition,
+                                              SymmetryBreaking::DigitRelabeling);
+      CHECK(Digits::isValid(puzzle.solution[8][8]));
+    }
+  }
+}
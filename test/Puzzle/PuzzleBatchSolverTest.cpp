@@ -0,0 +1,68 @@
+#include "PuzzleBatchSolver.hpp"
+
+#include <doctest.h>
+
+TEST_CASE("Puzzle Batch Solver") {
+  constexpr auto sudokuConstraints = ConstraintType::SUDOKU_CELL | ConstraintType::SUDOKU_ROW |
+                                     ConstraintType::SUDOKU_COLUMN | ConstraintType::SUDOKU_BOX;
+  constexpr auto sudokuSpace = PuzzleSpace{9, 9, 9};
+  auto batchSolver = PuzzleBatchSolver<sudokuSpace>(sudokuConstraints, 0);
+
+  constexpr auto input = Grid<sudokuSpace>{{
+      {1, 2, 0, 3, 0, 0, 4, 0, 0},
+      {5, 0, 0, 4, 0, 0, 1, 0, 0},
+      {0, 0, 0, 0, 2, 0, 0, 6, 0},
+      {7, 0, 0, 0, 0, 0, 0, 0, 0},
+      {0, 0, 0, 7, 0, 0, 0, 3, 1},
+      {0, 0, 0, 0, 5, 4, 7, 0, 0},
+      {4, 0, 0, 5, 0, 0, 3, 0, 0},
+      {0, 8, 0, 0, 0, 0, 0, 0, 0},
+      {0, 0, 9, 0, 4, 0, 0, 0, 0},
+  }};
+
+  SUBCASE("Same solutions as separate puzzles") {
+    auto lessGivens = input;
+    lessGivens[0][0] = Digits::invalidDigit;
+    lessGivens[8][2] = Digits::invalidDigit;
+    // Grids are solved one after the other with the same structure, in any order
+    for (const auto& grid : {input, Grid<sudokuSpace>{}, lessGivens, input}) {
+      const auto puzzle = Puzzle<sudokuSpace>("Puzzle", grid, sudokuConstraints, 0);
+      const auto solution = batchSolver.solve(grid);
+      REQUIRE(solution.has_value());
+      CHECK_EQ(batchSolver.hasUniqueSolution(grid), puzzle.hasUniqueSolution());
+      if (puzzle.hasUniqueSolution()) {
+        CHECK_EQ(solution.value(), puzzle.solution);
+      }
+      // Every solution keeps the givens, and is a solution of a puzzle with those givens
+      for (std::size_t row = 0; row < 9; row++) {
+        for (std::size_t column = 0; column < 9; column++) {
+          if (Digits::isValid(grid[row][column])) {
+            CHECK_EQ(solution.value()[row][column], grid[row][column]);
+          }
+        }
+      }
+      CHECK(Puzzle<sudokuSpace>("Solution", solution.value(), sudokuConstraints, 0).hasUniqueSolution());
+    }
+  }
+
+  SUBCASE("Restarts") {
+    // Restarting doesn't change the solution of a grid that has only one
+    auto restartingBatchSolver = PuzzleBatchSolver<sudokuSpace>(sudokuConstraints, 0, {{.baseNodesCount = 10}});
+    CHECK_EQ(restartingBatchSolver.solve(input), batchSolver.solve(input));
+    CHECK(restartingBatchSolver.solve({}).has_value());
+  }
+
+  SUBCASE("Conflicting givens") {
+    auto conflictingGrid = input;
+    conflictingGrid[0][2] = 1;
+    CHECK(!batchSolver.solve(conflictingGrid).has_value());
+    CHECK(!batchSolver.hasUniqueSolution(conflictingGrid));
+    CHECK(batchSolver.solve(input).has_value());
+  }
+
+  SUBCASE("Invalid digit") {
+    auto invalidGrid = input;
+    invalidGrid[0][2] = 10;
+    CHECK_THROWS_AS(batchSolver.solve(invalidGrid), std::runtime_error);
+  }
+}
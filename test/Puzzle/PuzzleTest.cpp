@@ -88,4 +88,102 @@ TEST_CASE("Puzzle") {
       CHECK_EQ(sudoku1.solution, sudoku2.solution);
     }
   }
+
+  SUBCASE("Uniqueness") {
+    constexpr ConstraintType latinSquareConstraints =
+        ConstraintType::SUDOKU_CELL | ConstraintType::SUDOKU_ROW | ConstraintType::SUDOKU_COLUMN;
+    constexpr auto smallSpace = PuzzleSpace{2, 2, 2};
+    const auto givenGrid = Grid<smallSpace>{{
+        {1, 0},
+        {0, 0},
+    }};
+    // Small puzzle spaces are checked with the bitset solver, larger ones with Algorithm C
+    static_assert(isBitsetSolverPreferred<smallSpace>);
+    CHECK(Puzzle<smallSpace>("Given", givenGrid, latinSquareConstraints, 0).hasUniqueSolution());
+    CHECK(!Puzzle<smallSpace>("Empty", {}, latinSquareConstraints, 0).hasUniqueSolution());
+    static_assert(!isBitsetSolverPreferred<PuzzleSpace{16, 16, 16}>);
+    CHECK(!Puzzle<{16, 16, 16}>("Empty", {}, latinSquareConstraints, 0).hasUniqueSolution());
+  }
+
+  SUBCASE("Solver statistics") {
+    constexpr ConstraintType sudokuConstraints = ConstraintType::SUDOKU_CELL | ConstraintType::SUDOKU_ROW |
+                                                 ConstraintType::SUDOKU_COLUMN | ConstraintType::SUDOKU_BOX;
+    const auto sudoku = Puzzle<{9, 9, 9}>("Sudoku", {}, sudokuConstraints, 0);
+    const auto& statistics = sudoku.solverStatistics;
+    if constexpr (AlgorithmC::areStatisticsEnabled) {
+      // The search stops at the first solution, which places a digit in every cell
+      CHECK_EQ(statistics.solutionsCount, 1);
+      CHECK_GE(statistics.nodesCount(), 82);
+      CHECK_EQ(statistics.nodesPerLevel[81], 1);
+      CHECK_GT(statistics.mems, 0);
+    } else {
+      CHECK_EQ(statistics.nodesCount(), 0);
+      CHECK_EQ(statistics.mems, 0);
+    }
+  }
+
+  SUBCASE("Restarts") {
+    constexpr ConstraintType sudokuConstraints = ConstraintType::SUDOKU_CELL | ConstraintType::SUDOKU_ROW |
+                                                 ConstraintType::SUDOKU_COLUMN | ConstraintType::SUDOKU_BOX;
+    constexpr auto sudokuSpace = PuzzleSpace{9, 9, 9};
+    const auto sudoku = Puzzle<sudokuSpace>("Sudoku", {}, sudokuConstraints, 0);
+    CHECK_EQ(sudoku.restartStrategy, std::nullopt);
+
+    // A search that never runs out of nodes finds the same solution as one without restarts
+    const auto neverRestarted = Puzzle<sudokuSpace>(
+        "Never Restarted", {}, sudokuConstraints, 0, SymmetryBreaking::None, {{.baseNodesCount = 1'000'000}});
+    CHECK_EQ(neverRestarted.solution, sudoku.solution);
+
+    // Restarting after every few nodes still completes the grid, the same way for the same seed
+    const auto restarted = Puzzle<sudokuSpace>(
+        "Restarted", {}, sudokuConstraints, 0, SymmetryBreaking::None, {{.baseNodesCount = 10}});
+    for (const auto& row : restarted.solution) {
+      CHECK(std::ranges::all_of(row, Digits::isValid));
+    }
+    const auto sameSeed = Puzzle<sudokuSpace>(
+        "Same Seed", {}, sudokuConstraints, 0, SymmetryBreaking::None, {{.baseNodesCount = 10}});
+    CHECK_EQ(restarted.solution, sameSeed.solution);
+  }
+
+  SUBCASE("Symmetry breaking") {
+    constexpr ConstraintType latinSquareConstraints =
+        ConstraintType::SUDOKU_CELL | ConstraintType::SUDOKU_ROW | ConstraintType::SUDOKU_COLUMN;
+    constexpr auto latinSquareSpace = PuzzleSpace{4, 4, 4};
+    const auto latinSquare =
+        Puzzle<latinSquareSpace>("Latin Square", {}, latinSquareConstraints, 0, SymmetryBreaking::DigitRelabeling);
+    CHECK_EQ(latinSquare.computeDigitClasses(), std::vector<uint32_t>{0, 0, 0, 0});
+    REQUIRE(latinSquare.createCanonicalGrid().has_value());
+    CHECK_EQ(latinSquare.createCanonicalGrid().value()[0], std::array<Digit, 4>{1, 2, 3, 4});
+    CHECK_EQ(latinSquare.computeSymmetryOrbitSize(), 24);
+
+    // Every relabeling of a solution of the canonical grid is counted
+    CHECK_EQ(latinSquare.countSolutions(), 576);
+    CHECK_EQ(Puzzle<latinSquareSpace>("Full", {}, latinSquareConstraints, 0).countSolutions(), 576);
+
+    // The relabeled solution is still a Latin square, drawn from the seed
+    for (std::size_t i = 0; i < 4; i++) {
+      std::vector<Digit> row(latinSquare.solution[i].begin(), latinSquare.solution[i].end());
+      std::vector<Digit> column;
+      for (std::size_t j = 0; j < 4; j++) {
+        column.push_back(latinSquare.solution[j][i]);
+      }
+      std::ranges::sort(row);
+      std::ranges::sort(column);
+      CHECK_EQ(row, std::vector<Digit>{1, 2, 3, 4});
+      CHECK_EQ(column, std::vector<Digit>{1, 2, 3, 4});
+    }
+    const auto sameSeed =
+        Puzzle<latinSquareSpace>("Same Seed", {}, latinSquareConstraints, 0, SymmetryBreaking::DigitRelabeling);
+    CHECK_EQ(latinSquare.solution, sameSeed.solution);
+
+    // Only even digits go on the diagonal, so odd and even digits cannot be relabeled into each other
+    const auto evenDiagonal = Puzzle<latinSquareSpace>("Even Diagonal",
+                                                       {},
+                                                       latinSquareConstraints | ConstraintType::POSITIVE_DIAGONAL_EVEN,
+                                                       0,
+                                                       SymmetryBreaking::DigitRelabeling);
+    CHECK_EQ(evenDiagonal.computeDigitClasses(), std::vector<uint32_t>{0, 1, 0, 1});
+    CHECK(!evenDiagonal.createCanonicalGrid().has_value());
+    CHECK_EQ(evenDiagonal.computeSymmetryOrbitSize(), 1);
+  }
 }
@@ -0,0 +1,106 @@
+#include "StaticPuzzleStructure.hpp"
+
+#include "AlgorithmC.hpp"
+#include "CellConstraint.hpp"
+#include "Exact3x3BoxesConstraint.hpp"
+#include "ExactColumnConstraint.hpp"
+#include "ExactRowConstraint.hpp"
+#include "IdPacking.hpp"
+#include "KingPatternConstraint.hpp"
+#include "Puzzle.hpp"
+
+#include <doctest.h>
+#include <ranges>
+
+/** Checks that two structures have the same lists.
+ * @param structure The structure.
+ * @param expectedStructure The expected structure.
+ */
+template <std::signed_integral Index>
+void checkSameLists(const BasicDancingCellsStructure<Index>& structure,
+                    const BasicDancingCellsStructure<Index>& expectedStructure) {
+  CHECK_EQ(structure.primaryItemsCount, expectedStructure.primaryItemsCount);
+  CHECK_EQ(structure.secondaryItemsCount, expectedStructure.secondaryItemsCount);
+  CHECK_EQ(structure.itemsCount, expectedStructure.itemsCount);
+  CHECK_EQ(structure.optionsCount, expectedStructure.optionsCount);
+  CHECK_EQ(structure.ITEM, expectedStructure.ITEM);
+  CHECK_EQ(structure.SET, expectedStructure.SET);
+  CHECK(std::ranges::equal(structure.NODE, expectedStructure.NODE));
+  CHECK_EQ(structure.nodeOptionIndices, expectedStructure.nodeOptionIndices);
+}
+
+TEST_CASE("Static Puzzle Structure") {
+  constexpr auto sudokuConstraints = ConstraintType::SUDOKU_CELL | ConstraintType::SUDOKU_ROW |
+                                     ConstraintType::SUDOKU_COLUMN | ConstraintType::SUDOKU_BOX;
+  constexpr auto sudokuSpace = PuzzleSpace{9, 9, 9};
+  constexpr auto& sudokuLists = StaticPuzzleStructure::lists<int32_t,
+                                                             sudokuSpace,
+                                                             CellConstraint,
+                                                             ExactRowConstraint,
+                                                             ExactColumnConstraint,
+                                                             Exact3x3BoxesConstraint>;
+
+  SUBCASE("Same structure as a puzzle without givens") {
+    const auto puzzle = Puzzle<sudokuSpace>("Puzzle", {}, sudokuConstraints, 0);
+    checkSameLists(DancingCellsStructure(sudokuLists), puzzle.structure);
+    static_assert(sudokuLists.primaryItemsCount == 4 * 81);
+    static_assert(sudokuLists.secondaryItemsCount == 0);
+  }
+
+  SUBCASE("Secondary items") {
+    // The options of the pattern constraints take long to compute at compile time, so a small grid is used
+    constexpr auto smallSpace = PuzzleSpace{3, 3, 9};
+    const auto puzzle = Puzzle<smallSpace>("Puzzle", {}, ConstraintType::SUDOKU_CELL | ConstraintType::KING_PATTERN, 0);
+    const auto& kingLists = StaticPuzzleStructure::lists<int32_t, smallSpace, CellConstraint, KingPatternConstraint>;
+    CHECK_GT(kingLists.secondaryItemsCount, 0);
+    checkSameLists(DancingCellsStructure(kingLists), puzzle.structure);
+  }
+
+  SUBCASE("Compact indices") {
+    const auto& compactLists = StaticPuzzleStructure::lists<int16_t,
+                                                            sudokuSpace,
+                                                            CellConstraint,
+                                                            ExactRowConstraint,
+                                                            ExactColumnConstraint,
+                                                            Exact3x3BoxesConstraint>;
+    const auto puzzle = Puzzle<sudokuSpace>("Puzzle", {}, sudokuConstraints, 0);
+    checkSameLists(CompactDancingCellsStructure(compactLists), CompactDancingCellsStructure(puzzle.structure));
+  }
+
+  SUBCASE("Givens forced into the search") {
+    constexpr auto input = Grid<sudokuSpace>{{
+        {1, 2, 0, 3, 0, 0, 4, 0, 0},
+        {5, 0, 0, 4, 0, 0, 1, 0, 0},
+        {0, 0, 0, 0, 2, 0, 0, 6, 0},
+        {7, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 0, 0, 7, 0, 0, 0, 3, 1},
+        {0, 0, 0, 0, 5, 4, 7, 0, 0},
+        {4, 0, 0, 5, 0, 0, 3, 0, 0},
+        {0, 8, 0, 0, 0, 0, 0, 0, 0},
+        {0, 0, 9, 0, 4, 0, 0, 0, 0},
+    }};
+    // Every possibility has the option at its packed ID
+    std::vector<int32_t> givenOptionIndices;
+    for (uint32_t row = 0; row < 9; row++) {
+      for (uint32_t column = 0; column < 9; column++) {
+        if (Digits::isValid(input[row][column])) {
+          const auto digit = static_cast<uint32_t>(input[row][column] - 1);
+          givenOptionIndices.push_back(static_cast<int32_t>(IdPacking::packId(row, column, digit, 9, 9, 9)));
+        }
+      }
+    }
+    auto solver = AlgorithmC::Solver(DancingCellsStructure(sudokuLists));
+    solver.forceOptions(givenOptionIndices);
+    const auto solution = solver.findOneSolution(0);
+    REQUIRE(solution.has_value());
+
+    const auto puzzle = Puzzle<sudokuSpace>("Puzzle", input, sudokuConstraints, 0);
+    const auto allPossibilities = puzzle.allPossibilities();
+    auto solvedGrid = Grid<sudokuSpace>{};
+    for (const auto optionIndex : solution.value()) {
+      const auto& [row, column, digit] = allPossibilities[optionIndex];
+      solvedGrid[row][column] = digit;
+    }
+    CHECK_EQ(solvedGrid, puzzle.solution);
+  }
+}
@@ -34,6 +34,7 @@ TEST_CASE("Sudoku Samples") {
 
     const auto puzzle = Puzzle<sudokuSpace>("LargeSearchTree", input, sudokuConstraints, 0);
     CHECK_EQ(puzzle.solution, solution);
+    CHECK(puzzle.hasUniqueSolution());
   }
 
   SUBCASE("Digits of pi with 32 clues (1)") {
@@ -63,6 +64,7 @@ TEST_CASE("Sudoku Samples") {
     }};
     const auto puzzle = Puzzle<sudokuSpace>("DigitsOfPi32Clues1", input, sudokuConstraints, 0);
     CHECK_EQ(puzzle.solution, solution);
+    CHECK(puzzle.hasUniqueSolution());
   }
 
   SUBCASE("Digits of pi with 32 clues (2)") {
@@ -93,6 +95,7 @@ TEST_CASE("Sudoku Samples") {
 
     const auto puzzle = Puzzle<sudokuSpace>("DigitsOfPi32Clues2", input, sudokuConstraints, 0);
     CHECK_EQ(puzzle.solution, solution);
+    CHECK(puzzle.hasUniqueSolution());
   }
 
   SUBCASE("Digits of pi with 17 clues") {
@@ -123,6 +126,7 @@ TEST_CASE("Sudoku Samples") {
 
     const auto puzzle = Puzzle<sudokuSpace>("DigitsOfPi17Clues", input, sudokuConstraints, 0);
     CHECK_EQ(puzzle.solution, solution);
+    CHECK(puzzle.hasUniqueSolution());
   }
 
   SUBCASE("Solvable with only naked singles") {
@@ -152,6 +156,7 @@ TEST_CASE("Sudoku Samples") {
 
     const auto puzzle = Puzzle<sudokuSpace>("SolvableWithOnlyNakedSingles", input, sudokuConstraints, 0);
     CHECK_EQ(puzzle.solution, solution);
+    CHECK(puzzle.hasUniqueSolution());
   }
 
   // Digits of pi, 16 clues: There's two solutions
@@ -1,17 +1,22 @@
 #include "AlgorithmC.hpp"
 
 #include "DancingCellsStructure.hpp"
+#include "SolverTestHelpers.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <doctest.h>
+#include <limits>
+#include <stdexcept>
+#include <stop_token>
 
 struct ProblemData {
-  ProblemData(const DancingCellsStructure& structure, const std::vector<std::unordered_set<int32_t>>& expectedSolutions)
+  ProblemData(const DancingCellsStructure& structure, const std::vector<XccSolution>& expectedSolutions)
       : structure(structure)
       , expectedSolutions(expectedSolutions) {};
 
   const DancingCellsStructure structure;
-  const std::vector<std::unordered_set<int32_t>> expectedSolutions;
+  const std::vector<XccSolution> expectedSolutions;
 };
 
 void check(const std::vector<ProblemData>& problemsData, const std::vector<std::optional<int32_t>>& seeds) {
@@ -28,6 +33,18 @@ void check(const std::vector<ProblemData>& problemsData, const std::vector<std::
         }
       }
 
+      {
+        // Uniqueness in parallel
+        for (const int32_t threadsCount : {1, 2, 4}) {
+          const auto solution = AlgorithmC::hasUniqueSolutionInParallel(structure, seed, threadsCount);
+          if (expectedSolutions.size() == 1) {
+            CHECK_EQ(solution, expectedSolutions.front());
+          } else {
+            CHECK_EQ(solution, std::nullopt);
+          }
+        }
+      }
+
       {
         // Find all solutions
         auto structureCopy = structure;
@@ -39,6 +56,113 @@ void check(const std::vector<ProblemData>& problemsData, const std::vector<std::
         }
       }
 
+      {
+        // Find all solutions in parallel
+        for (const int32_t threadsCount : {1, 2, 4}) {
+          auto structureCopy = structure;
+          const auto allSolutionsFound = AlgorithmC::findAllSolutionsInParallel(structureCopy, seed, threadsCount);
+          // Check that every solution found was expected
+          CHECK_EQ(allSolutionsFound.size(), expectedSolutions.size());
+          for (const auto& solutionFound : allSolutionsFound) {
+            CHECK_EQ(std::count(expectedSolutions.begin(), expectedSolutions.end(), solutionFound), 1);
+          }
+        }
+      }
+
+      {
+        // Count solutions
+        auto structureCopy = structure;
+        const auto expectedCount = static_cast<int64_t>(expectedSolutions.size());
+        CHECK_EQ(AlgorithmC::countSolutions(structureCopy, seed, {}), expectedCount);
+        for (const int64_t limit : {0, 1, 2, 3}) {
+          CHECK_EQ(AlgorithmC::countSolutions(structureCopy, seed, limit), std::min(expectedCount, limit));
+        }
+      }
+
+      {
+        // Visit every solution
+        auto structureCopy = structure;
+        std::vector<XccSolution> solutionsVisited;
+        const auto status =
+            AlgorithmC::forEachSolution(structureCopy, seed, [&](std::span<const int32_t> optionIndices) {
+              solutionsVisited.emplace_back(optionIndices);
+              return true;
+            });
+        CHECK_EQ(status, AlgorithmC::SearchStatus::Exhausted);
+        CHECK_EQ(solutionsVisited.size(), expectedSolutions.size());
+        for (const auto& solutionVisited : solutionsVisited) {
+          CHECK_EQ(std::count(expectedSolutions.begin(), expectedSolutions.end(), solutionVisited), 1);
+        }
+
+        // Stop the search after the first solution
+        int32_t visitsCount = 0;
+        const auto stoppedStatus = AlgorithmC::forEachSolution(structureCopy, seed, [&](std::span<const int32_t>) {
+          visitsCount++;
+          return false;
+        });
+        CHECK_EQ(visitsCount, std::min<int32_t>(static_cast<int32_t>(expectedSolutions.size()), 1));
+        CHECK_EQ(stoppedStatus,
+                 expectedSolutions.empty() ? AlgorithmC::SearchStatus::Exhausted : AlgorithmC::SearchStatus::Stopped);
+      }
+
+      {
+        // Reuse the same solver for multiple searches
+        AlgorithmC::Solver solver(structure);
+        const auto expectedCount = static_cast<int64_t>(expectedSolutions.size());
+        for (int32_t searchIndex = 0; searchIndex < 3; searchIndex++) {
+          const auto allSolutionsFound = solver.findAllSolutions(seed);
+          CHECK_EQ(allSolutionsFound.size(), expectedSolutions.size());
+          if (seed.has_value()) {
+            // The solver starts every search from the structure as it was loaded
+            CHECK_EQ(allSolutionsFound, AlgorithmC::findAllSolutions(structure, seed));
+            CHECK_EQ(solver.findOneSolution(seed), AlgorithmC::findOneSolution(structure, seed));
+          }
+          CHECK_EQ(solver.countSolutions(seed, {}), expectedCount);
+          CHECK_EQ(solver.hasUniqueSolution(seed).has_value(), expectedSolutions.size() == 1);
+        }
+      }
+
+      {
+        // Keep the items in buckets by their size instead of scanning for the smallest one
+        AlgorithmC::BasicSolver<AlgorithmC::BucketMrvPolicy> solver(structure);
+        const auto allSolutionsFound = solver.findAllSolutions(seed);
+        CHECK_EQ(allSolutionsFound.size(), expectedSolutions.size());
+        for (const auto& solutionFound : allSolutionsFound) {
+          CHECK_EQ(std::count(expectedSolutions.begin(), expectedSolutions.end(), solutionFound), 1);
+        }
+        CHECK_EQ(solver.hasUniqueSolution(seed).has_value(), expectedSolutions.size() == 1);
+      }
+
+      {
+        // Keep the sizes of the items in a table of their own
+        AlgorithmC::BasicSolver<AlgorithmC::SizeTableMrvPolicy> solver(structure);
+        const auto allSolutionsFound = solver.findAllSolutions(seed);
+        CHECK_EQ(allSolutionsFound.size(), expectedSolutions.size());
+        for (const auto& solutionFound : allSolutionsFound) {
+          CHECK_EQ(std::count(expectedSolutions.begin(), expectedSolutions.end(), solutionFound), 1);
+        }
+        CHECK_EQ(solver.hasUniqueSolution(seed).has_value(), expectedSolutions.size() == 1);
+      }
+
+      {
+        // Pull solutions one at a time
+        AlgorithmC::Solver solver(structure);
+        CHECK(!solver.nextSolution().has_value());
+        solver.startSearch(seed);
+        std::vector<XccSolution> solutionsPulled;
+        while (const auto solution = solver.nextSolution()) {
+          solutionsPulled.emplace_back(solution.value());
+        }
+        CHECK(!solver.nextSolution().has_value());
+        CHECK_EQ(solutionsPulled.size(), expectedSolutions.size());
+        for (const auto& solutionPulled : solutionsPulled) {
+          CHECK_EQ(std::count(expectedSolutions.begin(), expectedSolutions.end(), solutionPulled), 1);
+        }
+        if (seed.has_value()) {
+          CHECK_EQ(solutionsPulled, AlgorithmC::findAllSolutions(structure, seed));
+        }
+      }
+
       {
         // Find one solution
         auto structureCopy = structure;
@@ -55,6 +179,30 @@ void check(const std::vector<ProblemData>& problemsData, const std::vector<std::
   }
 }
 
+/** Checks that a solver with the given branching policy finds every solution of the empty 4x4 Sudoku exactly once, and
+ * that it finds them in the same order every time that it is given the same seed.
+ * @param branchingPolicy The branching policy of the solver
+ * @param seeds The seeds to search with
+ */
+template <AlgorithmC::BranchingPolicyConcept BranchingPolicy>
+void checkBranchingPolicy(const BranchingPolicy& branchingPolicy, const std::vector<std::optional<int32_t>>& seeds) {
+  const auto structure = SolverTestHelpers::createEmpty4x4SudokuStructure();
+  const auto expectedSolutions = AlgorithmC::findAllSolutions(structure, 0);
+  AlgorithmC::BasicSolver<BranchingPolicy> solver(structure, branchingPolicy);
+  for (const auto& seed : seeds) {
+    const auto solutions = solver.findAllSolutions(seed);
+    CHECK_EQ(solutions.size(), 288);
+    for (const auto& solution : solutions) {
+      CHECK_EQ(std::count(expectedSolutions.begin(), expectedSolutions.end(), solution), 1);
+    }
+    if (seed.has_value()) {
+      CHECK_EQ(solver.findAllSolutions(seed), solutions);
+    }
+    CHECK_EQ(solver.countSolutions(seed, 100), 100);
+    CHECK(!solver.hasUniqueSolution(seed).has_value());
+  }
+}
+
 TEST_CASE("Algorithm C") {
   const std::vector<std::optional<int32_t>> seeds = {std::nullopt, 0, 1, -566, 9845};
 
@@ -63,6 +211,9 @@ TEST_CASE("Algorithm C") {
     for (const auto& seed : seeds) {
       CHECK_EQ(AlgorithmC::hasUniqueSolution(structure, seed), std::nullopt);
       CHECK(AlgorithmC::findAllSolutions(structure, seed).empty());
+      CHECK(AlgorithmC::findAllSolutionsInParallel(structure, seed, 2).empty());
+      CHECK_EQ(AlgorithmC::hasUniqueSolutionInParallel(structure, seed, 2), std::nullopt);
+      CHECK_EQ(AlgorithmC::countSolutions(structure, seed, {}), 0);
       CHECK_EQ(AlgorithmC::findOneSolution(structure, seed), std::nullopt);
     }
   }
@@ -77,7 +228,7 @@ TEST_CASE("Algorithm C") {
         {{1, {3, 1}}}, // Option 3: 'q x:A' // Part of solution
         {{2, {4, 3}}}, // Option 4: 'r y:C'
     };
-    const std::unordered_set<int32_t> solution = {1, 3};
+    const XccSolution solution = {1, 3};
 
     for (const auto& seed : seeds) {
       auto structure = DancingCellsStructure(primaryItemsCount, secondaryItemsCount, options);
@@ -85,6 +236,10 @@ TEST_CASE("Algorithm C") {
       const auto allSolutions = AlgorithmC::findAllSolutions(structure, seed);
       CHECK_EQ(allSolutions.size(), 1);
       CHECK_EQ(*allSolutions.begin(), solution);
+      const auto allSolutionsInParallel = AlgorithmC::findAllSolutionsInParallel(structure, seed, 2);
+      CHECK_EQ(allSolutionsInParallel, allSolutions);
+      CHECK_EQ(AlgorithmC::hasUniqueSolutionInParallel(structure, seed, 2), solution);
+      CHECK_EQ(AlgorithmC::countSolutions(structure, seed, {}), 1);
       const auto oneSolutionOptional = AlgorithmC::findOneSolution(structure, seed);
       CHECK(oneSolutionOptional.has_value());
       CHECK_EQ(oneSolutionOptional, solution);
@@ -460,4 +615,462 @@ TEST_CASE("Algorithm C") {
 
     check(problemsData, seeds);
   }
+
+  SUBCASE("Parallel enumeration matches sequential enumeration") {
+    const auto structure = SolverTestHelpers::createEmpty4x4SudokuStructure();
+
+    for (const auto& seed : seeds) {
+      auto structureCopy = structure;
+      const auto sequentialSolutions = AlgorithmC::findAllSolutions(structureCopy, seed);
+      CHECK_EQ(sequentialSolutions.size(), 288);
+      CHECK_EQ(AlgorithmC::countSolutions(structureCopy, seed, {}), 288);
+      CHECK_EQ(AlgorithmC::countSolutions(structureCopy, seed, 100), 100);
+      for (const int32_t threadsCount : {1, 2, 3, 8}) {
+        const auto parallelSolutions = AlgorithmC::findAllSolutionsInParallel(structureCopy, seed, threadsCount);
+        CHECK_EQ(parallelSolutions.size(), sequentialSolutions.size());
+        for (const auto& solution : parallelSolutions) {
+          CHECK_EQ(std::count(sequentialSolutions.begin(), sequentialSolutions.end(), solution), 1);
+        }
+        // Two solutions are found in total long before the whole tree is explored
+        CHECK_EQ(AlgorithmC::hasUniqueSolutionInParallel(structureCopy, seed, threadsCount), std::nullopt);
+      }
+    }
+  }
+
+  SUBCASE("Interleaved searches") {
+    const auto structure = DancingCellsStructure(2, 0, {{0}, {0}, {1}, {0, 1}, {1}});
+    for (const auto& seed : seeds) {
+      AlgorithmC::Solver solverA(structure);
+      AlgorithmC::Solver solverB(structure);
+      solverA.startSearch(seed);
+      solverB.startSearch(seed);
+      std::vector<XccSolution> solutionsA;
+      std::vector<XccSolution> solutionsB;
+      // Pull one solution from the first solver, then two from the second one, and so on
+      bool isExhaustedA = false;
+      bool isExhaustedB = false;
+      while (!isExhaustedA || !isExhaustedB) {
+        if (const auto solution = solverA.nextSolution()) {
+          solutionsA.emplace_back(solution.value());
+        } else {
+          isExhaustedA = true;
+        }
+        for (int32_t i = 0; i < 2; i++) {
+          if (const auto solution = solverB.nextSolution()) {
+            solutionsB.emplace_back(solution.value());
+          } else {
+            isExhaustedB = true;
+          }
+        }
+      }
+      CHECK_EQ(solutionsA.size(), 5);
+      CHECK_EQ(solutionsB.size(), 5);
+      if (seed.has_value()) {
+        CHECK_EQ(solutionsA, solutionsB);
+      }
+    }
+  }
+
+  SUBCASE("Solver loads multiple problems") {
+    const auto structureA = DancingCellsStructure(2, 0, {{0}, {0}, {1}, {0, 1}});
+    const auto structureB = DancingCellsStructure(3, 0, {{0, 1}, {1, 2}, {2}});
+    const auto structureC = DancingCellsStructure(1, 0, {{0}, {0}, {0}});
+
+    AlgorithmC::Solver solver(structureA);
+    for (const auto& seed : seeds) {
+      solver.load(structureA);
+      CHECK_EQ(solver.countSolutions(seed, {}), 3);
+      solver.load(structureB);
+      CHECK_EQ(solver.findAllSolutions(seed), std::vector<XccSolution>{{0, 2}});
+      solver.load(structureC);
+      CHECK_EQ(solver.countSolutions(seed, {}), 3);
+      CHECK(!solver.hasUniqueSolution(seed).has_value());
+      solver.load(structureA);
+      CHECK_EQ(solver.countSolutions(seed, {}), 3);
+    }
+  }
+
+  SUBCASE("Forced options") {
+    // Option (row * 4 + column) * 4 + digit places the digit in the cell
+    const auto structure = SolverTestHelpers::createEmpty4x4SudokuStructure();
+    AlgorithmC::Solver solver(structure);
+    AlgorithmC::CompactSolver compactSolver(structure);
+    for (const auto& seed : seeds) {
+      const std::vector<int32_t> forcedOptions = {0, 7};
+      solver.forceOptions(forcedOptions);
+      compactSolver.forceOptions(forcedOptions);
+      // Relabeling the digits maps the solutions with digits 0 and 3 in the first two cells onto each other
+      CHECK_EQ(solver.countSolutions(seed, {}), 288 / 12);
+      CHECK_EQ(compactSolver.countSolutions(seed, {}), 288 / 12);
+      for (const auto& solution : solver.findAllSolutions(seed)) {
+        CHECK(std::ranges::contains(solution, 0));
+        CHECK(std::ranges::contains(solution, 7));
+      }
+      CHECK_EQ(compactSolver.findAllSolutions(seed).size(), 288 / 12);
+
+      // The same digit twice in the first row, or the same cell twice
+      solver.forceOptions(std::vector<int32_t>{0, 4});
+      CHECK_EQ(solver.countSolutions(seed, {}), 0);
+      CHECK(!solver.findOneSolution(seed).has_value());
+      solver.forceOptions(std::vector<int32_t>{0, 0});
+      CHECK_EQ(solver.countSolutions(seed, {}), 0);
+
+      // Forcing nothing, or loading a problem, releases the forced options
+      solver.forceOptions({});
+      CHECK_EQ(solver.countSolutions(seed, {}), 288);
+      compactSolver.load(structure);
+      CHECK_EQ(compactSolver.countSolutions(seed, {}), 288);
+    }
+
+    // Options that don't agree on the color of a secondary item conflict
+    const auto coloredStructure = DancingCellsStructure(2, 1, {{{0, {2, 1}}}, {{1, {2, 2}}}, {{1, {2, 1}}}, {{2}}});
+    AlgorithmC::Solver coloredSolver(coloredStructure);
+    coloredSolver.forceOptions(std::vector<int32_t>{0});
+    CHECK_EQ(coloredSolver.findAllSolutions(0), std::vector<XccSolution>{{0, 2}});
+    coloredSolver.forceOptions(std::vector<int32_t>{0, 1});
+    CHECK_EQ(coloredSolver.countSolutions(0, {}), 0);
+    CHECK_THROWS_AS(coloredSolver.forceOptions(std::vector<int32_t>{3}), std::runtime_error);
+    CHECK_THROWS_AS(coloredSolver.forceOptions(std::vector<int32_t>{4}), std::runtime_error);
+  }
+
+  SUBCASE("Search budget") {
+    const auto structure = SolverTestHelpers::createEmpty4x4SudokuStructure();
+    AlgorithmC::Solver solver(structure);
+
+    for (const auto& seed : seeds) {
+      // Node limit
+      solver.setBudget({.maximumNodesCount = 20});
+      CHECK_LT(solver.countSolutions(seed, {}), 288);
+      CHECK_EQ(solver.status(), AlgorithmC::SearchStatus::CutOff);
+      solver.setBudget({.maximumNodesCount = 1'000'000});
+      CHECK_EQ(solver.countSolutions(seed, {}), 288);
+      CHECK_EQ(solver.status(), AlgorithmC::SearchStatus::Exhausted);
+
+      // Deadline that has already passed
+      solver.setBudget({.deadline = std::chrono::steady_clock::now()});
+      CHECK_EQ(solver.findOneSolution(seed), std::nullopt);
+      CHECK_EQ(solver.status(), AlgorithmC::SearchStatus::CutOff);
+      solver.setBudget({.deadline = std::chrono::steady_clock::now() + std::chrono::hours(1)});
+      CHECK_EQ(solver.countSolutions(seed, {}), 288);
+      CHECK_EQ(solver.status(), AlgorithmC::SearchStatus::Exhausted);
+
+      // Stop requested before the search starts
+      std::stop_source stoppedSource;
+      stoppedSource.request_stop();
+      solver.setBudget({.stopToken = stoppedSource.get_token()});
+      CHECK_EQ(solver.forEachSolution(seed, [](std::span<const int32_t>) { return true; }),
+               AlgorithmC::SearchStatus::CutOff);
+      solver.startSearch(seed);
+      CHECK_EQ(solver.nextSolution(), std::nullopt);
+      CHECK_EQ(solver.status(), AlgorithmC::SearchStatus::CutOff);
+
+      // Stop requested while searching
+      std::stop_source stopSource;
+      solver.setBudget({.stopToken = stopSource.get_token()});
+      int32_t solutionsCount = 0;
+      const auto status = solver.forEachSolution(seed, [&](std::span<const int32_t>) {
+        solutionsCount++;
+        if (solutionsCount == 5) {
+          stopSource.request_stop();
+        }
+        return true;
+      });
+      CHECK_EQ(status, AlgorithmC::SearchStatus::CutOff);
+      CHECK_EQ(solutionsCount, 5);
+
+      // Without a budget the search is complete again
+      solver.setBudget({});
+      CHECK_EQ(solver.countSolutions(seed, {}), 288);
+      CHECK_EQ(solver.status(), AlgorithmC::SearchStatus::Exhausted);
+    }
+
+    // A unique solution is not reported as such when the search is cut off before proving it
+    const auto uniqueStructure = DancingCellsStructure(4, // Primary items
+                                                       0, // Secondary items
+                                                       {
+                                                           /*{1, 1, 0, 0}*/ {0, 1},
+                                                           /*{0, 1, 0, 1}*/ {1, 3},
+                                                           /*{1, 1, 1, 1}*/ {0, 1, 2, 3}, // Part of solution
+                                                           /*{1, 0, 0, 1}*/ {0, 3},
+                                                           /*{0, 0, 1, 0}*/ {2},
+                                                       });
+    AlgorithmC::Solver uniqueSolver(uniqueStructure);
+    for (const auto& seed : seeds) {
+      bool wasSolutionFoundBeforeCutOff = false;
+      for (int64_t maximumNodesCount = 1; maximumNodesCount <= 10; maximumNodesCount++) {
+        uniqueSolver.setBudget({.maximumNodesCount = maximumNodesCount});
+        const auto uniqueSolution = uniqueSolver.hasUniqueSolution(seed);
+        const auto status = uniqueSolver.status();
+        if (uniqueSolution.has_value()) {
+          CHECK_EQ(status, AlgorithmC::SearchStatus::Exhausted);
+          CHECK_EQ(uniqueSolution.value(), XccSolution({2}));
+        } else {
+          CHECK_EQ(status, AlgorithmC::SearchStatus::CutOff);
+          wasSolutionFoundBeforeCutOff |= uniqueSolver.countSolutions(seed, {}) == 1;
+        }
+      }
+      CHECK(uniqueSolver.hasUniqueSolution(seed).has_value());
+      if (seed.has_value()) {
+        CHECK(wasSolutionFoundBeforeCutOff);
+      }
+    }
+  }
+
+  SUBCASE("Restarts") {
+    // Luby sequence 1, 1, 2, 1, 1, 2, 4, 1, 1, 2, 1, 1, 2, 4, 8
+    const std::vector<int64_t> lubyTerms = {1, 1, 2, 1, 1, 2, 4, 1, 1, 2, 1, 1, 2, 4, 8};
+    for (int32_t attemptIndex = 0; attemptIndex < static_cast<int32_t>(lubyTerms.size()); attemptIndex++) {
+      CHECK_EQ(AlgorithmC::attemptNodesLimit({.baseNodesCount = 10}, attemptIndex), 10 * lubyTerms[attemptIndex]);
+    }
+    const AlgorithmC::RestartStrategy geometric = {.schedule = AlgorithmC::RestartSchedule::Geometric,
+                                                   .baseNodesCount = 10,
+                                                   .growthFactor = 1.5};
+    CHECK_EQ(AlgorithmC::attemptNodesLimit(geometric, 0), 10);
+    CHECK_EQ(AlgorithmC::attemptNodesLimit(geometric, 2), 22);
+    // Limits saturate instead of overflowing
+    CHECK_EQ(AlgorithmC::attemptNodesLimit(geometric, 1000), std::numeric_limits<int64_t>::max());
+    CHECK_EQ(AlgorithmC::attemptNodesLimit({.baseNodesCount = std::numeric_limits<int64_t>::max()}, 2),
+             std::numeric_limits<int64_t>::max());
+    CHECK_THROWS_AS(AlgorithmC::attemptNodesLimit({.baseNodesCount = 0}, 0), std::runtime_error);
+    CHECK_THROWS_AS(AlgorithmC::attemptNodesLimit({.schedule = AlgorithmC::RestartSchedule::Geometric,
+                                                   .growthFactor = 0.5},
+                                                  0),
+                    std::runtime_error);
+
+    const auto structure = SolverTestHelpers::createEmpty4x4SudokuStructure();
+    const auto expectedSolutions = AlgorithmC::findAllSolutions(structure, 0);
+    AlgorithmC::Solver solver(structure);
+    for (const auto& seed : seeds) {
+      // Attempts of a single node always restart, until the limit has grown enough to reach a solution
+      for (const auto& strategy : {AlgorithmC::RestartStrategy{.baseNodesCount = 1}, geometric}) {
+        const auto solution = solver.findOneSolutionWithRestarts(seed, strategy);
+        REQUIRE(solution.has_value());
+        CHECK_EQ(std::ranges::count(expectedSolutions, solution.value()), 1);
+        CHECK_EQ(solver.status(), AlgorithmC::SearchStatus::Stopped);
+        if (seed.has_value()) {
+          CHECK_EQ(solver.findOneSolutionWithRestarts(seed, strategy), solution);
+        }
+      }
+
+      // An attempt that is never restarted uses the given seed
+      if (seed.has_value()) {
+        CHECK_EQ(solver.findOneSolutionWithRestarts(seed, {.baseNodesCount = 1000000}), solver.findOneSolution(seed));
+      }
+
+      // The budget limits all attempts together, and is kept for the following searches
+      solver.setBudget({.maximumNodesCount = 10});
+      CHECK_EQ(solver.findOneSolutionWithRestarts(seed, {.baseNodesCount = 1}), std::nullopt);
+      CHECK_EQ(solver.status(), AlgorithmC::SearchStatus::CutOff);
+      CHECK_LT(solver.countSolutions(seed, {}), 288);
+      CHECK_EQ(solver.status(), AlgorithmC::SearchStatus::CutOff);
+      solver.setBudget({.deadline = std::chrono::steady_clock::now()});
+      CHECK_EQ(solver.findOneSolutionWithRestarts(seed, {.baseNodesCount = 1}), std::nullopt);
+      CHECK_EQ(solver.status(), AlgorithmC::SearchStatus::CutOff);
+      solver.setBudget({});
+
+      // An attempt that exhausts its search tree proves that there's no solution
+      const auto noSolutionStructure = DancingCellsStructure(3, 0, {{0, 1}, {1, 2}, {0, 2}});
+      CHECK_EQ(AlgorithmC::findOneSolutionWithRestarts(noSolutionStructure, seed, {.baseNodesCount = 1}),
+               std::nullopt);
+      CHECK_EQ(AlgorithmC::findOneSolutionWithRestarts(DancingCellsStructure(0, 0, {}), seed, {}), std::nullopt);
+    }
+  }
+
+  SUBCASE("Portfolio") {
+    const auto structure = SolverTestHelpers::createEmpty4x4SudokuStructure();
+    const auto expectedSolutions = AlgorithmC::findAllSolutions(structure, 0);
+    for (const auto& seed : seeds) {
+      for (const int32_t threadsCount : {1, 2, 4}) {
+        for (const int32_t searchesCount : {1, 3, 8}) {
+          const auto [solution, winningSeed] =
+              AlgorithmC::findOneSolutionWithPortfolio(structure, seed, searchesCount, threadsCount);
+          REQUIRE(solution.has_value());
+          CHECK_EQ(std::ranges::count(expectedSolutions, solution.value()), 1);
+          // The winning seed reproduces the solution on its own
+          REQUIRE(winningSeed.has_value());
+          CHECK_EQ(AlgorithmC::findOneSolution(structure, winningSeed), solution);
+        }
+      }
+
+      // A search that exhausts its search tree proves that there's no solution
+      const auto noSolutionStructure = DancingCellsStructure(3, 0, {{0, 1}, {1, 2}, {0, 2}});
+      const auto noSolution = AlgorithmC::findOneSolutionWithPortfolio(noSolutionStructure, seed, 4, 2);
+      CHECK_EQ(noSolution.solution, std::nullopt);
+      CHECK_EQ(noSolution.winningSeed, std::nullopt);
+      CHECK_EQ(AlgorithmC::findOneSolutionWithPortfolio(DancingCellsStructure(0, 0, {}), seed, 2, 2).solution,
+               std::nullopt);
+    }
+    CHECK_THROWS_AS(AlgorithmC::findOneSolutionWithPortfolio(structure, 0, 0, 2), std::runtime_error);
+  }
+
+  SUBCASE("Compact indices") {
+    // With the same seed, solvers on 16 bit indices make the same choices as the ones on 32 bit indices
+    const auto structure = SolverTestHelpers::createEmpty4x4SudokuStructure();
+    AlgorithmC::Solver solver(structure);
+    AlgorithmC::CompactSolver compactSolver(structure);
+    AlgorithmC::BasicSolver<AlgorithmC::SizeTableMrvPolicy> sizeTableSolver(structure);
+    AlgorithmC::BasicSolver<AlgorithmC::SizeTableMrvPolicy, int16_t> compactSizeTableSolver(structure);
+    for (const auto& seed : seeds) {
+      if (!seed.has_value()) {
+        continue;
+      }
+      const auto solutions = solver.findAllSolutions(seed);
+      CHECK_EQ(compactSolver.findAllSolutions(seed), solutions);
+      CHECK_EQ(compactSolver.statistics().mems, solver.statistics().mems);
+      CHECK_EQ(compactSizeTableSolver.findAllSolutions(seed), sizeTableSolver.findAllSolutions(seed));
+      CHECK_EQ(AlgorithmC::findAllSolutions(structure, seed), solutions);
+    }
+
+    // Problems that don't fit are rejected by the compact solvers, the functions fall back to 32 bit indices
+    const auto largeStructure = DancingCellsStructure(1, 0, std::vector<std::vector<XccElement>>(40000, {0}));
+    CHECK_THROWS_AS(AlgorithmC::CompactSolver(largeStructure), std::runtime_error);
+    CHECK_THROWS_AS(compactSolver.load(largeStructure), std::runtime_error);
+    CHECK_EQ(compactSolver.countSolutions(0, {}), 288);
+    CHECK_EQ(AlgorithmC::countSolutions(largeStructure, 0, {}), 40000);
+  }
+
+  SUBCASE("Search statistics") {
+    AlgorithmC::Solver solver(SolverTestHelpers::createEmpty4x4SudokuStructure());
+    for (const auto& seed : seeds) {
+      CHECK_EQ(solver.countSolutions(seed, {}), 288);
+      const auto statistics = solver.statistics();
+      if constexpr (AlgorithmC::areStatisticsEnabled) {
+        // One level for every primary item, plus the one where solutions are found
+        CHECK_EQ(statistics.nodesPerLevel.size(), 65);
+        CHECK_EQ(statistics.nodesPerLevel.front(), 1);
+        // Every solution places 16 digits
+        CHECK_EQ(statistics.nodesPerLevel[16], 288);
+        CHECK_EQ(statistics.solutionsCount, 288);
+        CHECK_GT(statistics.hideCallsCount, statistics.nodesCount());
+        CHECK_GT(statistics.mems, statistics.hideCallsCount);
+        CHECK_GT(statistics.backtracksCount, 0);
+
+        // Statistics are reset by every search
+        CHECK_EQ(solver.countSolutions(seed, {}), 288);
+        CHECK_EQ(solver.statistics().solutionsCount, 288);
+        if (seed.has_value()) {
+          CHECK_EQ(solver.statistics().nodesCount(), statistics.nodesCount());
+          CHECK_EQ(solver.statistics().mems, statistics.mems);
+        }
+
+        // Nodes beyond the budget are not entered
+        solver.setBudget({.maximumNodesCount = 10});
+        CHECK_LT(solver.countSolutions(seed, {}), 288);
+        CHECK_EQ(solver.statistics().nodesCount(), 10);
+        solver.setBudget({});
+      } else {
+        CHECK(statistics.nodesPerLevel.empty());
+        CHECK_EQ(statistics.solutionsCount, 0);
+        CHECK_EQ(statistics.hideCallsCount, 0);
+        CHECK_EQ(statistics.mems, 0);
+      }
+    }
+  }
+
+  SUBCASE("Tree size estimates") {
+    for (const auto& seed : seeds) {
+      // Every node of a level has as many branches, so every path gives the exact size of the tree
+      const auto tiedStructure = DancingCellsStructure(2, 0, {{0}, {0}, {1}, {1}});
+      const auto tiedEstimate = AlgorithmC::estimateTreeSize(tiedStructure, 10, seed);
+      CHECK_EQ(tiedEstimate.nodesCount, 7);
+      CHECK_EQ(tiedEstimate.nodesCountVariance, 0);
+      CHECK_EQ(tiedEstimate.solutionsCount, 4);
+      CHECK_EQ(tiedEstimate.samplesCount, 10);
+
+      // Every branch of the root leaves an item without options, so only the root is entered
+      const auto noSolutionStructure = DancingCellsStructure(3, 0, {{0, 1}, {1, 2}, {0, 2}});
+      const auto noSolutionEstimate = AlgorithmC::estimateTreeSize(noSolutionStructure, 3, seed);
+      CHECK_EQ(noSolutionEstimate.nodesCount, 1);
+      CHECK_EQ(noSolutionEstimate.solutionsCount, 0);
+
+      const auto emptyEstimate = AlgorithmC::estimateTreeSize(DancingCellsStructure(0, 0, {}), 3, seed);
+      CHECK_EQ(emptyEstimate.nodesCount, 0);
+      CHECK_EQ(emptyEstimate.samplesCount, 3);
+    }
+
+    // With enough samples, the estimates get close to the actual search tree
+    const auto structure = SolverTestHelpers::createEmpty4x4SudokuStructure();
+    AlgorithmC::BasicSolver<AlgorithmC::FirstMrvPolicy> solver(structure);
+    const auto estimate = solver.estimateTreeSize(2000, 0);
+    CHECK_EQ(estimate.samplesCount, 2000);
+    CHECK_GT(estimate.solutionsCount, 0.9 * 288);
+    CHECK_LT(estimate.solutionsCount, 1.1 * 288);
+    // Every solution is a leaf 16 levels below the root
+    CHECK_GT(estimate.nodesCount, 288 + 16);
+    CHECK_EQ(solver.countSolutions(0, {}), 288);
+    if constexpr (AlgorithmC::areStatisticsEnabled) {
+      const auto nodesCount = static_cast<double>(solver.statistics().nodesCount());
+      CHECK_GT(estimate.nodesCount, 0.9 * nodesCount);
+      CHECK_LT(estimate.nodesCount, 1.1 * nodesCount);
+    }
+    // The policies that track the sizes of the items are told about every change that a path undoes
+    AlgorithmC::BasicSolver<AlgorithmC::BucketMrvPolicy> bucketSolver(structure);
+    AlgorithmC::BasicSolver<AlgorithmC::SizeTableMrvPolicy> sizeTableSolver(structure);
+    const auto policyEstimates = {bucketSolver.estimateTreeSize(2000, 0), sizeTableSolver.estimateTreeSize(2000, 0)};
+    for (const auto& policyEstimate : policyEstimates) {
+      CHECK_GT(policyEstimate.solutionsCount, 0.9 * 288);
+      CHECK_LT(policyEstimate.solutionsCount, 1.1 * 288);
+    }
+    // The same seed walks the same paths
+    const auto sameEstimate = solver.estimateTreeSize(2000, 0);
+    CHECK_EQ(sameEstimate.nodesCount, estimate.nodesCount);
+    CHECK_EQ(sameEstimate.nodesCountVariance, estimate.nodesCountVariance);
+
+    // Forced options are chosen at the first levels of every path
+    solver.forceOptions(std::vector<int32_t>{0});
+    const auto forcedSolutionsCount = static_cast<double>(solver.countSolutions(0, {}));
+    const auto forcedEstimate = solver.estimateTreeSize(2000, 0);
+    CHECK_GT(forcedEstimate.solutionsCount, 0.9 * forcedSolutionsCount);
+    CHECK_LT(forcedEstimate.solutionsCount, 1.1 * forcedSolutionsCount);
+    CHECK_LT(forcedEstimate.nodesCount, estimate.nodesCount);
+
+    // A budget that is already spent leaves no paths
+    solver.setBudget({.deadline = std::chrono::steady_clock::now()});
+    CHECK_EQ(solver.estimateTreeSize(10, 0).samplesCount, 0);
+    CHECK_EQ(solver.status(), AlgorithmC::SearchStatus::CutOff);
+    // The nodes of every path count against the budget
+    solver.setBudget({.maximumNodesCount = 1});
+    CHECK_EQ(solver.estimateTreeSize(10, 0).samplesCount, 0);
+    CHECK_EQ(solver.status(), AlgorithmC::SearchStatus::CutOff);
+    solver.setBudget({.maximumNodesCount = 40});
+    const auto cutOffEstimate = solver.estimateTreeSize(10, 0);
+    CHECK_GT(cutOffEstimate.samplesCount, 0);
+    CHECK_LT(cutOffEstimate.samplesCount, 10);
+    solver.setBudget({});
+    CHECK_EQ(solver.estimateTreeSize(10, 0).samplesCount, 10);
+    CHECK_EQ(solver.status(), AlgorithmC::SearchStatus::Exhausted);
+    CHECK_THROWS_AS(solver.estimateTreeSize(0, 0), std::runtime_error);
+  }
+
+  SUBCASE("Branching policies") {
+    checkBranchingPolicy(AlgorithmC::FirstMrvPolicy(), seeds);
+    checkBranchingPolicy(AlgorithmC::RandomMrvPolicy(), seeds);
+    checkBranchingPolicy(AlgorithmC::ReservoirMrvPolicy(), seeds);
+    checkBranchingPolicy(AlgorithmC::BucketMrvPolicy(), seeds);
+    checkBranchingPolicy(AlgorithmC::SizeTableMrvPolicy(), seeds);
+    // Prefer the box items, then the cell items, then nothing at all
+    checkBranchingPolicy(AlgorithmC::PreferredItemsMrvPolicy(48, 16), seeds);
+    checkBranchingPolicy(AlgorithmC::PreferredItemsMrvPolicy(0, 16), seeds);
+    checkBranchingPolicy(AlgorithmC::PreferredItemsMrvPolicy(), seeds);
+
+    // Without random tie-breaking, the seed doesn't matter
+    const auto structure = SolverTestHelpers::createEmpty4x4SudokuStructure();
+    AlgorithmC::BasicSolver<AlgorithmC::FirstMrvPolicy> firstSolver(structure);
+    const auto firstSolutions = firstSolver.findAllSolutions(0);
+    for (const auto& seed : seeds) {
+      CHECK_EQ(firstSolver.findAllSolutions(seed), firstSolutions);
+    }
+
+    // Both items have two options, the preferred one is branched on first
+    const auto tiedStructure = DancingCellsStructure(2, 0, {{0}, {0}, {1}, {1}});
+    AlgorithmC::BasicSolver<AlgorithmC::FirstMrvPolicy> tiedFirstSolver(tiedStructure);
+    CHECK_EQ(tiedFirstSolver.findAllSolutions(0), std::vector<XccSolution>{{0, 2}, {0, 3}, {1, 2}, {1, 3}});
+    AlgorithmC::BasicSolver<AlgorithmC::PreferredItemsMrvPolicy> tiedPreferredSolver(
+        tiedStructure, AlgorithmC::PreferredItemsMrvPolicy(1, 1));
+    CHECK_EQ(tiedPreferredSolver.findAllSolutions(0), std::vector<XccSolution>{{0, 2}, {1, 2}, {0, 3}, {1, 3}});
+    // Preferring items that don't exist is the same as not preferring any
+    AlgorithmC::BasicSolver<AlgorithmC::PreferredItemsMrvPolicy> outOfRangeSolver(
+        tiedStructure, AlgorithmC::PreferredItemsMrvPolicy(5, 3));
+    CHECK_EQ(outOfRangeSolver.findAllSolutions(0), tiedFirstSolver.findAllSolutions(0));
+  }
 }
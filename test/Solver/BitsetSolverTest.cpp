@@ -0,0 +1,78 @@
+#include "BitsetSolver.hpp"
+
+#include "AlgorithmC.hpp"
+#include "DancingCellsStructure.hpp"
+#include "SolverTestHelpers.hpp"
+
+#include <doctest.h>
+#include <stdexcept>
+
+/** Checks that the bitset solver finds exactly the solutions that Algorithm C finds.
+ * @param structure The data structure representing XCC problem.
+ */
+template <std::size_t wordsCount>
+void checkBitsetSolver(const DancingCellsStructure& structure) {
+  BitsetSolver<wordsCount> solver(structure);
+  SolverTestHelpers::checkSameSolutions(structure,
+                                        solver.findAllSolutions(),
+                                        solver.countSolutions({}),
+                                        solver.hasUniqueSolution(),
+                                        solver.findOneSolution());
+}
+
+TEST_CASE("Bitset Solver") {
+
+  SUBCASE("Empty Structure") {
+    const auto structure = DancingCellsStructure(0, 0, {});
+    BitsetSolver<1> solver(structure);
+    CHECK(solver.findAllSolutions().empty());
+    CHECK_EQ(solver.countSolutions({}), 0);
+    CHECK_EQ(solver.findOneSolution(), std::nullopt);
+    CHECK_EQ(solver.hasUniqueSolution(), std::nullopt);
+  }
+
+  SUBCASE("Single solution, primary and secondary items with colors") {
+    const auto structure = SolverTestHelpers::createColoredStructure();
+    BitsetSolver<1> solver(structure);
+    CHECK_EQ(solver.hasUniqueSolution(), XccSolution{1, 3});
+    checkBitsetSolver<1>(structure);
+  }
+
+  SUBCASE("Multiple solutions, primary and secondary items") {
+    checkBitsetSolver<1>(DancingCellsStructure(4, 3, {{2, 4}, {0, 3, 6}, {1, 2, 5}, {0, 3, 5}, {1, 6}, {3, 4, 6}}));
+    checkBitsetSolver<1>(DancingCellsStructure(3, 1, {{2}, {0, 3}, {1, 2}, {}, {0, 1}}));
+    checkBitsetSolver<1>(DancingCellsStructure(3, 2, {{1}, {0, 2, 4}, {}, {1, 3, 4}, {1, 3}, {1}}));
+  }
+
+  SUBCASE("No solutions") {
+    checkBitsetSolver<1>(DancingCellsStructure(3, 0, {{0, 1}, {1, 2}, {0, 2}}));
+  }
+
+  SUBCASE("Empty 4x4 Sudoku") {
+    const auto structure = SolverTestHelpers::createEmpty4x4SudokuStructure();
+    checkBitsetSolver<1>(structure);
+    // Wider bitmasks than necessary find the same solutions
+    checkBitsetSolver<3>(structure);
+
+    BitsetSolver<1> solver(structure);
+    SolverTestHelpers::checkEmpty4x4SudokuStops(
+        [&](const std::optional<int64_t>& limit) { return solver.countSolutions(limit); },
+        [&](const AlgorithmC::SolutionVisitor& visitor) { return solver.forEachSolution(visitor); });
+  }
+
+  SUBCASE("Capacity") {
+    std::vector<std::vector<XccElement>> options(65, {0});
+    const auto structure = DancingCellsStructure(1, 0, options);
+    CHECK(!BitsetSolver<1>::fits(structure));
+    CHECK_THROWS_AS(BitsetSolver<1>(structure), std::runtime_error);
+    CHECK(BitsetSolver<2>::fits(structure));
+    CHECK_EQ(BitsetSolver<2>(structure).countSolutions({}), 65);
+  }
+
+  SUBCASE("Puzzle spaces") {
+    static_assert(bitsetWordsCount<PuzzleSpace{4, 4, 4}> == 1);
+    static_assert(bitsetWordsCount<PuzzleSpace{9, 9, 9}> == 12);
+    static_assert(isBitsetSolverPreferred<PuzzleSpace{9, 9, 9}>);
+    static_assert(!isBitsetSolverPreferred<PuzzleSpace{16, 16, 16}>);
+  }
+}
@@ -0,0 +1,57 @@
+#include "BranchingPolicies.hpp"
+
+#include <algorithm>
+#include <doctest.h>
+#include <limits>
+#include <random>
+#include <vector>
+
+TEST_CASE("Branching Policies") {
+
+  SUBCASE("Find first smallest") {
+    CHECK_EQ(AlgorithmC::findFirstSmallest({}), 0);
+
+    const std::vector<int32_t> single = {7};
+    CHECK_EQ(AlgorithmC::findFirstSmallest(single), 0);
+
+    // The first of multiple smallest values is found, wherever it ends up in the SIMD registers
+    const std::vector<int32_t> ties = {5, 3, 9, 3, 4, 3, 8, 6, 3, 7, 2, 5, 2};
+    CHECK_EQ(AlgorithmC::findFirstSmallest(ties), 10);
+    CHECK_EQ(AlgorithmC::findFirstSmallest(std::span<const int32_t>(ties.data(), 10)), 1);
+
+    constexpr int32_t maxInt = std::numeric_limits<int32_t>::max();
+    const std::vector<int32_t> padded = {4, 2, 6, maxInt, maxInt, maxInt, maxInt, maxInt};
+    CHECK_EQ(AlgorithmC::findFirstSmallest(padded), 1);
+
+    // The search stops at the first value that is small enough
+    CHECK_EQ(AlgorithmC::findFirstSmallest(ties, 3), 1);
+    CHECK_EQ(AlgorithmC::findFirstSmallest(ties, 2), 10);
+    CHECK_EQ(AlgorithmC::findFirstSmallest(ties, 1), 10);
+    CHECK_EQ(AlgorithmC::findFirstSmallest(ties, 5), 0);
+    CHECK_EQ(AlgorithmC::findFirstSmallest(padded, maxInt), 0);
+
+    // Every amount of values, up to a few registers, with the smallest value at every position
+    std::mt19937 generator(0);
+    std::uniform_int_distribution<int32_t> distribution(0, 50);
+    for (std::size_t valuesCount = 1; valuesCount <= 40; valuesCount++) {
+      std::vector<int32_t> values(valuesCount);
+      for (auto& value : values) {
+        value = distribution(generator);
+      }
+      CHECK_EQ(AlgorithmC::findFirstSmallest(values),
+               static_cast<std::size_t>(std::ranges::min_element(values) - values.begin()));
+      for (const int32_t smallEnough : {0, 1, 10, 25}) {
+        const auto smallEnoughValue = std::ranges::find_if(values, [&](int32_t value) { return value <= smallEnough; });
+        const auto expectedValue =
+            smallEnoughValue != values.end() ? smallEnoughValue : std::ranges::min_element(values);
+        CHECK_EQ(AlgorithmC::findFirstSmallest(values, smallEnough),
+                 static_cast<std::size_t>(expectedValue - values.begin()));
+      }
+      for (std::size_t smallestIndex = 0; smallestIndex < valuesCount; smallestIndex++) {
+        auto valuesWithSmallest = values;
+        valuesWithSmallest[smallestIndex] = -1;
+        CHECK_EQ(AlgorithmC::findFirstSmallest(valuesWithSmallest), smallestIndex);
+      }
+    }
+  }
+}
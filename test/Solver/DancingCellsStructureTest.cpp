@@ -1,6 +1,11 @@
 #include "DancingCellsStructure.hpp"
 
+#include "XccOptions.hpp"
+
+#include <algorithm>
+#include <array>
 #include <doctest.h>
+#include <stdexcept>
 
 TEST_CASE("Dancing Cells Structure") {
   const std::vector<std::optional<int32_t>> seeds = {std::nullopt, 0, 1, -566, 9845};
@@ -161,4 +166,129 @@ TEST_CASE("Dancing Cells Structure") {
       CHECK_EQ(5, structure.optionsCount);
     }
   }
+
+  SUBCASE("Compact indices") {
+    const std::vector<std::vector<XccElement>> options = {
+        {{0, 1, {3, 3}, {4, 1}}}, // Option 0: 'p q x:C y:A'
+        {{0, 2, {3, 1}, {4, 3}}}, // Option 1: 'p r x:A y:C'
+        {{0, {3, 2}}}, // Option 2: 'p x:B'
+        {{1, {3, 1}}}, // Option 3: 'q x:A'
+        {{2, {4, 3}}}, // Option 4: 'r y:C'
+    };
+    const auto structure = DancingCellsStructure(3, 2, options);
+    REQUIRE(CompactDancingCellsStructure::fits(structure));
+
+    // Converting a structure gives the same lists as creating it with compact indices right away
+    const auto convertedStructure = CompactDancingCellsStructure(structure);
+    const auto compactStructure = CompactDancingCellsStructure(3, 2, options);
+    CHECK_EQ(convertedStructure.ITEM, compactStructure.ITEM);
+    CHECK_EQ(convertedStructure.SET, compactStructure.SET);
+    CHECK_EQ(convertedStructure.NODE, compactStructure.NODE);
+    CHECK(std::ranges::equal(compactStructure.ITEM, structure.ITEM));
+    CHECK(std::ranges::equal(compactStructure.SET, structure.SET));
+    CHECK(std::ranges::equal(compactStructure.NODE, structure.NODE, [](const auto& compactNode, const auto& node) {
+      return compactNode.item == node.item && compactNode.location == node.location && compactNode.color == node.color;
+    }));
+    CHECK_EQ(compactStructure.nodeOptionIndices, structure.nodeOptionIndices);
+    CHECK_EQ(compactStructure.optionsCount, structure.optionsCount);
+    CHECK_EQ(sizeof(compactStructure.NODE.front()), 6);
+
+    // Too many nodes for 16 bit indices
+    const auto largeOptions = std::vector<std::vector<XccElement>>(40000, {0});
+    const auto largeStructure = DancingCellsStructure(1, 0, largeOptions);
+    CHECK(!CompactDancingCellsStructure::fits(largeStructure));
+    CHECK_THROWS_AS(CompactDancingCellsStructure(largeStructure), std::runtime_error);
+    CHECK_THROWS_AS(CompactDancingCellsStructure(1, 0, largeOptions), std::runtime_error);
+
+    // A color that is too large for 16 bit indices
+    const auto colorOptions = std::vector<std::vector<XccElement>>{{{0, {1, 40000}}}};
+    CHECK(!CompactDancingCellsStructure::fits(DancingCellsStructure(1, 1, colorOptions)));
+    CHECK_THROWS_AS(CompactDancingCellsStructure(1, 1, colorOptions), std::runtime_error);
+  }
+
+  SUBCASE("Flat options") {
+    const std::vector<std::vector<XccElement>> options = {
+        {{0, 1, {3, 3}, {4, 1}}}, // Option 0: 'p q x:C y:A'
+        {{0, 2, {3, 1}, {4, 3}}}, // Option 1: 'p r x:A y:C'
+        {}, // Option 2: empty
+        {{0, {3, 2}}}, // Option 3: 'p x:B'
+        {{1, {3, 1}}}, // Option 4: 'q x:A'
+        {{2, {4, 3}}}, // Option 5: 'r y:C'
+    };
+    const auto createFlatStructure = [](int32_t primaryItemsCount,
+                                        int32_t secondaryItemsCount,
+                                        const XccOptions& flatOptions) {
+      return DancingCellsStructure(
+          primaryItemsCount, secondaryItemsCount, flatOptions.elements(), flatOptions.offsets());
+    };
+
+    // Both layouts of the same options give the same lists
+    const auto structure = DancingCellsStructure(3, 2, options);
+    const auto flatStructure = createFlatStructure(3, 2, options);
+    CHECK_EQ(flatStructure.ITEM, structure.ITEM);
+    CHECK_EQ(flatStructure.SET, structure.SET);
+    CHECK_EQ(flatStructure.NODE, structure.NODE);
+    CHECK_EQ(flatStructure.nodeOptionIndices, structure.nodeOptionIndices);
+    CHECK_EQ(flatStructure.optionsCount, structure.optionsCount);
+    const auto flatOptions = XccOptions(options);
+    CHECK_EQ(CompactDancingCellsStructure(3, 2, flatOptions.elements(), flatOptions.offsets()).NODE.size(),
+             structure.NODE.size());
+
+    // The same preconditions are checked
+    CHECK_THROWS_AS(createFlatStructure(2, 0, std::vector<std::vector<XccElement>>{{0}}), std::runtime_error);
+    CHECK_THROWS_AS(createFlatStructure(2, 0, std::vector<std::vector<XccElement>>{{1, 0}}), std::runtime_error);
+    CHECK_THROWS_AS(createFlatStructure(1, 0, std::vector<std::vector<XccElement>>{{0, 1}}), std::runtime_error);
+    CHECK_THROWS_AS(createFlatStructure(1, 0, XccOptions()), std::runtime_error);
+    CHECK_NOTHROW(createFlatStructure(0, 0, XccOptions()));
+
+    // Offsets that don't match the elements
+    const auto elements = std::vector<XccElement>{0, 1};
+    CHECK_THROWS_AS(DancingCellsStructure(2, 0, elements, std::vector<int32_t>{}), std::runtime_error);
+    CHECK_THROWS_AS(DancingCellsStructure(2, 0, elements, std::vector<int32_t>{0, 1}), std::runtime_error);
+    CHECK_THROWS_AS(DancingCellsStructure(2, 0, elements, std::vector<int32_t>{0, 2, 1, 2}), std::runtime_error);
+    CHECK_NOTHROW(DancingCellsStructure(2, 0, elements, std::vector<int32_t>{0, 1, 2}));
+  }
+
+  SUBCASE("Static lists") {
+    // The options of the flat layout, without colors: 'p q x', 'p r y', empty, 'p x', 'q x', 'r y'
+    constexpr auto itemIds = std::array{0, 1, 3, 0, 2, 4, 0, 3, 1, 3, 2, 4};
+    constexpr auto offsets = std::array{0, 3, 6, 6, 8, 10, 12};
+    using Lists = StaticDancingCellsStructure<int32_t, 5, 6, 12>;
+    constexpr auto lists = Lists::create(3, itemIds, offsets);
+    static_assert(lists.ITEM[0] == 2);
+
+    const auto structure = DancingCellsStructure(3,
+                                                 2,
+                                                 {
+                                                     {0, 1, 3},
+                                                     {0, 2, 4},
+                                                     {},
+                                                     {0, 3},
+                                                     {1, 3},
+                                                     {2, 4},
+                                                 });
+    const auto staticStructure = DancingCellsStructure(lists);
+    CHECK_EQ(staticStructure.ITEM, structure.ITEM);
+    CHECK_EQ(staticStructure.SET, structure.SET);
+    CHECK_EQ(staticStructure.NODE, structure.NODE);
+    CHECK_EQ(staticStructure.nodeOptionIndices, structure.nodeOptionIndices);
+    CHECK_EQ(staticStructure.primaryItemsCount, structure.primaryItemsCount);
+    CHECK_EQ(staticStructure.secondaryItemsCount, structure.secondaryItemsCount);
+    CHECK_EQ(staticStructure.itemsCount, structure.itemsCount);
+    CHECK_EQ(staticStructure.optionsCount, structure.optionsCount);
+    CHECK_EQ(CompactDancingCellsStructure(StaticDancingCellsStructure<int16_t, 5, 6, 12>::create(3, itemIds, offsets))
+                 .NODE.size(),
+             structure.NODE.size());
+
+    // The same preconditions are checked, which fail the compilation in a constant expression
+    const auto unsortedIds = std::array{0, 2, 1, 3, 0, 3, 1, 3, 1, 3, 2, 4};
+    CHECK_THROWS_AS(Lists::create(3, unsortedIds, offsets), std::runtime_error);
+    const auto uncoveredIds = std::array{0, 1, 3, 0, 1, 3, 0, 3, 1, 3, 1, 3};
+    CHECK_THROWS_AS(Lists::create(3, uncoveredIds, offsets), std::runtime_error);
+    const auto invalidIds = std::array{0, 1, 5, 0, 2, 4, 0, 3, 1, 3, 2, 4};
+    CHECK_THROWS_AS(Lists::create(3, invalidIds, offsets), std::runtime_error);
+    const auto invalidOffsets = std::array{0, 3, 6, 6, 8, 10, 11};
+    CHECK_THROWS_AS(Lists::create(3, itemIds, invalidOffsets), std::runtime_error);
+    CHECK_THROWS_AS(Lists::create(0, itemIds, offsets), std::runtime_error);
+  }
 }
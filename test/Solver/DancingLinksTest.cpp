@@ -0,0 +1,87 @@
+#include "DancingLinks.hpp"
+
+#include "AlgorithmC.hpp"
+#include "DancingCellsStructure.hpp"
+#include "SolverTestHelpers.hpp"
+
+#include <chrono>
+#include <doctest.h>
+
+/** Checks that Algorithm C finds exactly the same solutions with dancing links as with dancing cells.
+ * @param structure The data structure representing XCC problem.
+ * @param seeds The seeds to search with
+ */
+void checkDancingLinks(const DancingCellsStructure& structure, const std::vector<std::optional<int32_t>>& seeds) {
+  AlgorithmC::DancingLinksSolver solver(structure);
+  for (const auto& seed : seeds) {
+    const auto solutions = solver.findAllSolutions(seed);
+    if (seed.has_value()) {
+      // The same seed finds the solutions in the same order
+      CHECK_EQ(solver.findAllSolutions(seed), solutions);
+    }
+    SolverTestHelpers::checkSameSolutions(structure,
+                                          solutions,
+                                          solver.countSolutions(seed, {}),
+                                          solver.hasUniqueSolution(seed),
+                                          solver.findOneSolution(seed));
+  }
+}
+
+TEST_CASE("Dancing Links") {
+  const std::vector<std::optional<int32_t>> seeds = {std::nullopt, 0, 1, -566, 9845};
+
+  SUBCASE("Empty Structure") {
+    const auto structure = DancingCellsStructure(0, 0, {});
+    AlgorithmC::DancingLinksSolver solver(structure);
+    for (const auto& seed : seeds) {
+      CHECK(solver.findAllSolutions(seed).empty());
+      CHECK_EQ(solver.countSolutions(seed, {}), 0);
+      CHECK_EQ(solver.findOneSolution(seed), std::nullopt);
+      CHECK_EQ(solver.hasUniqueSolution(seed), std::nullopt);
+    }
+  }
+
+  SUBCASE("Single solution, primary and secondary items with colors") {
+    const auto structure = SolverTestHelpers::createColoredStructure();
+    AlgorithmC::DancingLinksSolver solver(structure);
+    CHECK_EQ(solver.hasUniqueSolution(0), XccSolution{1, 3});
+    checkDancingLinks(structure, seeds);
+  }
+
+  SUBCASE("Multiple solutions, primary and secondary items") {
+    checkDancingLinks(DancingCellsStructure(4, 3, {{2, 4}, {0, 3, 6}, {1, 2, 5}, {0, 3, 5}, {1, 6}, {3, 4, 6}}), seeds);
+    checkDancingLinks(DancingCellsStructure(3, 1, {{2}, {0, 3}, {1, 2}, {}, {0, 1}}), seeds);
+    checkDancingLinks(DancingCellsStructure(3, 2, {{1}, {0, 2, 4}, {}, {1, 3, 4}, {1, 3}, {1}}), seeds);
+  }
+
+  SUBCASE("No solutions") {
+    checkDancingLinks(DancingCellsStructure(3, 0, {{0, 1}, {1, 2}, {0, 2}}), seeds);
+  }
+
+  SUBCASE("Empty 4x4 Sudoku") {
+    constexpr int32_t size = 4;
+    const auto structure = SolverTestHelpers::createEmpty4x4SudokuStructure();
+    checkDancingLinks(structure, seeds);
+
+    AlgorithmC::DancingLinksSolver solver(structure);
+    const int32_t seed = 0;
+    SolverTestHelpers::checkEmpty4x4SudokuStops(
+        [&](const std::optional<int64_t>& limit) { return solver.countSolutions(seed, limit); },
+        [&](const AlgorithmC::SolutionVisitor& visitor) { return solver.forEachSolution(seed, visitor); });
+    if constexpr (AlgorithmC::areStatisticsEnabled) {
+      CHECK_EQ(solver.statistics().solutionsCount, 288);
+      CHECK_EQ(solver.statistics().nodesPerLevel[size * size], 288);
+    }
+
+    // Search budget
+    solver.setBudget({.maximumNodesCount = 20});
+    CHECK_LT(solver.countSolutions(seed, {}), 288);
+    CHECK_EQ(solver.status(), AlgorithmC::SearchStatus::CutOff);
+    solver.setBudget({.deadline = std::chrono::steady_clock::now()});
+    CHECK_EQ(solver.findOneSolution(seed), std::nullopt);
+    CHECK_EQ(solver.status(), AlgorithmC::SearchStatus::CutOff);
+    solver.setBudget({.maximumNodesCount = 1'000'000});
+    CHECK_EQ(solver.countSolutions(seed, {}), 288);
+    CHECK_EQ(solver.status(), AlgorithmC::SearchStatus::Exhausted);
+  }
+}
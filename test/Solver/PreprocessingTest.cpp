@@ -0,0 +1,114 @@
+#include "Preprocessing.hpp"
+
+#include "AlgorithmC.hpp"
+#include "DancingCellsStructure.hpp"
+#include "SolverTestHelpers.hpp"
+
+#include <doctest.h>
+#include <vector>
+
+/** Checks that the solutions of the reduced problem map back to exactly the solutions of the original problem.
+ * @param primaryItemsCount The amount of primary items.
+ * @param secondaryItemsCount The amount of secondary items.
+ * @param options The list of options.
+ * @return The reduced problem.
+ */
+Preprocessing::ReducedProblem checkSameSolutions(int32_t primaryItemsCount,
+                                                 int32_t secondaryItemsCount,
+                                                 const std::vector<std::vector<XccElement>>& options) {
+  const auto problem = Preprocessing::reduceProblem(primaryItemsCount, secondaryItemsCount, options);
+  std::vector<XccSolution> solutions;
+  if (problem.isSolved) {
+    solutions.push_back(problem.toOriginalSolution({}));
+  } else {
+    for (const auto& solution : AlgorithmC::findAllSolutions(problem.createStructure(), 0)) {
+      const auto optionIndices = std::vector<int32_t>(solution.begin(), solution.end());
+      solutions.push_back(problem.toOriginalSolution(optionIndices));
+    }
+  }
+  const auto expectedSolutions = SolverTestHelpers::checkSameSolutions(
+      DancingCellsStructure(primaryItemsCount, secondaryItemsCount, options), solutions);
+  CHECK_EQ(problem.isInfeasible, expectedSolutions.empty());
+  return problem;
+}
+
+TEST_CASE("Preprocessing") {
+
+  SUBCASE("Empty problem") {
+    const auto problem = Preprocessing::reduceProblem(0, 0, {});
+    CHECK(!problem.isInfeasible);
+    CHECK(!problem.isSolved);
+    CHECK(AlgorithmC::findAllSolutions(problem.createStructure(), 0).empty());
+  }
+
+  SUBCASE("Single solution, primary and secondary items with colors") {
+    const auto problem = checkSameSolutions(SolverTestHelpers::coloredPrimaryItemsCount,
+                                            SolverTestHelpers::coloredSecondaryItemsCount,
+                                            SolverTestHelpers::createColoredOptions());
+    // Choosing 'p q x:C y:A' leaves nothing for r, and choosing 'p x:B' leaves nothing for q
+    CHECK(problem.isSolved);
+    CHECK_EQ(XccSolution(problem.forcedOptionIndices), XccSolution{1, 3});
+    CHECK_EQ(problem.toOriginalSolution({}), XccSolution{1, 3});
+    CHECK(problem.options.empty());
+  }
+
+  SUBCASE("Multiple solutions, primary and secondary items") {
+    checkSameSolutions(4, 3, {{2, 4}, {0, 3, 6}, {1, 2, 5}, {0, 3, 5}, {1, 6}, {3, 4, 6}});
+    checkSameSolutions(3, 1, {{2}, {0, 3}, {1, 2}, {}, {0, 1}});
+    checkSameSolutions(3, 2, {{1}, {0, 2, 4}, {}, {1, 3, 4}, {1, 3}, {1}});
+  }
+
+  SUBCASE("No solutions") {
+    const auto problem = checkSameSolutions(3, 0, {{0, 1}, {1, 2}, {0, 2}});
+    CHECK(problem.isInfeasible);
+    CHECK(AlgorithmC::findAllSolutions(problem.createStructure(), 0).empty());
+  }
+
+  SUBCASE("Partial reduction") {
+    // Item 0 only has option 0, which forces it. That removes option 1 and fixes the secondary item 3 to color 1.
+    const auto problem = checkSameSolutions(3,
+                                            2,
+                                            {
+                                                {{0, {3, 1}}},
+                                                {{1, {3, 2}}},
+                                                {{1, 2, {3, 1}, 4}},
+                                                {{1, 4}},
+                                                {{2, 4}},
+                                                {{1, 2}},
+                                            });
+    CHECK(!problem.isSolved);
+    CHECK_EQ(problem.forcedOptionIndices, std::vector<int32_t>{0});
+    CHECK_EQ(problem.originalOptionIndices, std::vector<int32_t>{2, 3, 4, 5});
+    // Items 1 and 2 are left, along with the secondary item 4. The fixed secondary item 3 is dropped.
+    CHECK_EQ(problem.primaryItemsCount, 2);
+    CHECK_EQ(problem.secondaryItemsCount, 1);
+    REQUIRE_EQ(problem.options[0].size(), 3);
+    CHECK_EQ(problem.options[0][0].id, 0);
+    CHECK_EQ(problem.options[0][1].id, 1);
+    CHECK_EQ(problem.options[0][2].id, 2);
+  }
+
+  SUBCASE("4x4 Sudoku") {
+    constexpr int32_t size = 4;
+    // The givens keep only the option of their digit in their cell
+    const auto createOptions = [&](const std::vector<std::vector<int32_t>>& givens) {
+      auto options = SolverTestHelpers::createEmpty4x4SudokuOptions();
+      std::erase_if(options, [&](const std::vector<XccElement>& option) {
+        const int32_t given = givens[option[0].id / size][option[0].id % size];
+        return given != 0 && given != option[1].id % size + 1;
+      });
+      return options;
+    };
+
+    // Without any givens, nothing can be reduced
+    const auto noGivens = std::vector<std::vector<int32_t>>(size, std::vector<int32_t>(size, 0));
+    const auto emptyProblem = Preprocessing::reduceProblem(4 * size * size, 0, createOptions(noGivens));
+    CHECK(emptyProblem.forcedOptionIndices.empty());
+    CHECK_EQ(emptyProblem.options.size(), size * size * size);
+
+    // A few givens settle most of the grid
+    const auto problem =
+        checkSameSolutions(4 * size * size, 0, createOptions({{1, 0, 0, 0}, {0, 0, 3, 0}, {0, 4, 0, 0}, {0, 0, 0, 2}}));
+    CHECK_LT(problem.options.size(), 20);
+  }
+}
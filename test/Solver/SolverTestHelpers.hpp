@@ -0,0 +1,135 @@
+#pragma once
+
+#include "AlgorithmC.hpp"
+#include "DancingCellsStructure.hpp"
+#include "XccElement.hpp"
+#include "XccSolution.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <doctest.h>
+#include <functional>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace SolverTestHelpers {
+
+/// The amount of primary items p q r of the problem of createColoredOptions()
+constexpr int32_t coloredPrimaryItemsCount = 3;
+/// The amount of secondary items x y of the problem of createColoredOptions()
+constexpr int32_t coloredSecondaryItemsCount = 2;
+
+/** Creates the options of a problem with primary and secondary items with colors, whose only solution is {1, 3}.
+ * @return The options
+ */
+inline std::vector<std::vector<XccElement>> createColoredOptions() {
+  return {
+      {{0, 1, {3, 3}, {4, 1}}}, // 'p q x:C y:A'
+      {{0, 2, {3, 1}, {4, 3}}}, // 'p r x:A y:C'
+      {{0, {3, 2}}}, // 'p x:B'
+      {{1, {3, 1}}}, // 'q x:A'
+      {{2, {4, 3}}}, // 'r y:C'
+  };
+}
+
+/** Creates the structure of the problem of createColoredOptions().
+ * @return The structure
+ */
+inline DancingCellsStructure createColoredStructure() {
+  return DancingCellsStructure(coloredPrimaryItemsCount, coloredSecondaryItemsCount, createColoredOptions());
+}
+
+/** Creates the options of an empty 4x4 Sudoku, which has 288 solutions.
+ * Every option places a digit in a cell, and covers the cell, row, column, and box items of that digit. The first item
+ * of an option is its cell, the second one is its row item, whose id modulo 4 is its digit.
+ * @return The options, ordered by cell and then by digit
+ */
+inline std::vector<std::vector<XccElement>> createEmpty4x4SudokuOptions() {
+  constexpr int32_t size = 4;
+  std::vector<std::vector<XccElement>> options;
+  for (int32_t row = 0; row < size; row++) {
+    for (int32_t column = 0; column < size; column++) {
+      for (int32_t digit = 0; digit < size; digit++) {
+        const int32_t box = (row / 2) * 2 + column / 2;
+        options.push_back({row * size + column,
+                           size * size + row * size + digit,
+                           2 * size * size + column * size + digit,
+                           3 * size * size + box * size + digit});
+      }
+    }
+  }
+  return options;
+}
+
+/** Creates the structure of an empty 4x4 Sudoku, see createEmpty4x4SudokuOptions().
+ * @return The structure
+ */
+inline DancingCellsStructure createEmpty4x4SudokuStructure() {
+  return DancingCellsStructure(4 * 4 * 4, 0, createEmpty4x4SudokuOptions());
+}
+
+/** Checks that solutions found some other way are exactly the ones that Algorithm C finds, in any order.
+ * @param structure The data structure representing XCC problem.
+ * @param solutions The solutions found some other way.
+ * @return The solutions that Algorithm C finds, in lexicographical order.
+ */
+inline std::vector<XccSolution> checkSameSolutions(const DancingCellsStructure& structure,
+                                                   std::vector<XccSolution> solutions) {
+  const auto order = [](const XccSolution& a, const XccSolution& b) {
+    return std::ranges::lexicographical_compare(a, b);
+  };
+  auto expectedSolutions = AlgorithmC::findAllSolutions(structure, 0);
+  std::ranges::sort(expectedSolutions, order);
+  std::ranges::sort(solutions, order);
+  CHECK_EQ(solutions, expectedSolutions);
+  return expectedSolutions;
+}
+
+/** Checks that another solver agrees with Algorithm C on every kind of search of a problem.
+ * @param structure The data structure representing XCC problem.
+ * @param solutions All the solutions found by the solver, in any order.
+ * @param solutionsCount The amount of solutions counted by the solver.
+ * @param uniqueSolution What the solver's uniqueness check returned.
+ * @param oneSolution The single solution that the solver found, if any.
+ */
+inline void checkSameSolutions(const DancingCellsStructure& structure,
+                               std::vector<XccSolution> solutions,
+                               int64_t solutionsCount,
+                               const std::optional<XccSolution>& uniqueSolution,
+                               const std::optional<XccSolution>& oneSolution) {
+  const auto expectedSolutions = checkSameSolutions(structure, std::move(solutions));
+  CHECK_EQ(solutionsCount, static_cast<int64_t>(expectedSolutions.size()));
+  CHECK_EQ(uniqueSolution.has_value(), expectedSolutions.size() == 1);
+  CHECK_EQ(oneSolution.has_value(), !expectedSolutions.empty());
+  if (oneSolution.has_value()) {
+    CHECK_EQ(std::ranges::count(expectedSolutions, oneSolution.value()), 1);
+  }
+}
+
+/** Checks that another solver of the empty 4x4 Sudoku stops at a limit on the amount of solutions, and as soon as its
+ * visitor asks it to.
+ * @param countSolutions Counts the solutions up to the given limit, or all of them without one.
+ * @param forEachSolution Reports every solution to the visitor until it returns false, and returns how the search ended.
+ */
+inline void checkEmpty4x4SudokuStops(
+    const std::function<int64_t(const std::optional<int64_t>&)>& countSolutions,
+    const std::function<AlgorithmC::SearchStatus(const AlgorithmC::SolutionVisitor&)>& forEachSolution) {
+  CHECK_EQ(countSolutions(288), 288);
+  CHECK_EQ(countSolutions(100), 100);
+  CHECK_EQ(countSolutions(0), 0);
+  int64_t visitedCount = 0;
+  const auto status = forEachSolution([&](std::span<const int32_t> optionIndices) {
+    CHECK_EQ(optionIndices.size(), 4 * 4);
+    visitedCount++;
+    return visitedCount < 10;
+  });
+  CHECK_EQ(status, AlgorithmC::SearchStatus::Stopped);
+  CHECK_EQ(visitedCount, 10);
+  // A stopped search leaves nothing behind, the next one finds every solution again
+  CHECK_EQ(forEachSolution([](std::span<const int32_t>) { return true; }), AlgorithmC::SearchStatus::Exhausted);
+  CHECK_EQ(countSolutions({}), 288);
+}
+
+} // namespace SolverTestHelpers
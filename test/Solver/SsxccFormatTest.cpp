@@ -0,0 +1,117 @@
+#include "SsxccFormat.hpp"
+
+#include "AlgorithmC.hpp"
+
+#include <doctest.h>
+#include <sstream>
+#include <stdexcept>
+
+/** Reads a problem from a text.
+ * @param text The text of the problem.
+ * @return The problem.
+ */
+SsxccFormat::Problem readText(const std::string& text) {
+  std::istringstream input(text);
+  return SsxccFormat::read(input);
+}
+
+/** Writes a problem to a text.
+ * @param problem The problem.
+ * @return The text of the problem.
+ */
+std::string writeText(const SsxccFormat::Problem& problem) {
+  std::ostringstream output;
+  SsxccFormat::write(output, problem);
+  return output.str();
+}
+
+TEST_CASE("SSXCC Format") {
+  // The example of color controls of The Art of Computer Programming, Volume 4B, 7.2.2.1-(49)
+  const std::string example = "| A simple example of color controls\n"
+                              "p q r | x y\n"
+                              "p q x y:A\n"
+                              "p r x:A y\n"
+                              "\n"
+                              "  p x:B\n"
+                              "| Options may list their items in any order\n"
+                              "x:A q\n"
+                              "r y:B\r\n";
+
+  SUBCASE("Read") {
+    const auto problem = readText(example);
+    CHECK_EQ(problem.itemNames, std::vector<std::string>{"p", "q", "r", "x", "y"});
+    CHECK_EQ(problem.colorNames, std::vector<std::string>{"A", "B"});
+    CHECK_EQ(problem.primaryItemsCount, 3);
+    CHECK_EQ(problem.secondaryItemsCount, 2);
+    REQUIRE_EQ(problem.options.size(), 5);
+    REQUIRE_EQ(problem.options[3].size(), 2);
+    CHECK_EQ(problem.options[3][0].id, 1);
+    CHECK_EQ(problem.options[3][0].colorId, XccElement::undefinedColor());
+    CHECK_EQ(problem.options[3][1].id, 3);
+    CHECK_EQ(problem.options[3][1].colorId, 1);
+
+    // 'q x:A' and 'p r x:A y' is the only solution
+    CHECK_EQ(AlgorithmC::findAllSolutions(problem.createStructure(), 0), std::vector<XccSolution>{{1, 3}});
+  }
+
+  SUBCASE("Write") {
+    CHECK_EQ(writeText(readText(example)),
+             "p q r | x y\n"
+             "p q x y:A\n"
+             "p r x:A y\n"
+             "p x:B\n"
+             "q x:A\n"
+             "r y:B\n");
+    CHECK_EQ(writeText(readText("a b\na\nb\n")), "a b\na\nb\n");
+  }
+
+  SUBCASE("Structure round trip") {
+    const auto structure = DancingCellsStructure(3,
+                                                 2,
+                                                 {
+                                                     {{0, 1, {3, 7}, {4, -1}}},
+                                                     {{0, 2, {3, -1}, 4}},
+                                                     {},
+                                                     {{0, {3, 2}}},
+                                                     {{1, {3, -1}}},
+                                                     {{2, {4, 7}}},
+                                                 });
+    const auto problem = SsxccFormat::fromStructure(structure);
+    CHECK_EQ(problem.colorNames, std::vector<std::string>{"c-1", "c2", "c7"});
+    CHECK_EQ(writeText(problem),
+             "i0 i1 i2 | i3 i4\n"
+             "i0 i1 i3:c7 i4:c-1\n"
+             "i0 i2 i3:c-1 i4\n"
+             "i0 i3:c2\n"
+             "i1 i3:c-1\n"
+             "i2 i4:c7\n");
+
+    // The empty option is dropped, so the option indices of the solutions shift past it
+    const auto readStructure = readText(writeText(problem)).createStructure();
+    CHECK_EQ(AlgorithmC::findAllSolutions(readStructure, 0), std::vector<XccSolution>{{1, 3}});
+    CHECK_EQ(AlgorithmC::findAllSolutions(structure, 0), std::vector<XccSolution>{{1, 4}});
+  }
+
+  SUBCASE("Invalid problems") {
+    CHECK_THROWS_AS(readText(""), std::runtime_error);
+    CHECK_THROWS_AS(readText("| Only a comment\n"), std::runtime_error);
+    CHECK_THROWS_AS(readText("| x y\n"), std::runtime_error);
+    CHECK_THROWS_AS(readText("a b a\n"), std::runtime_error);
+    CHECK_THROWS_AS(readText("a | b | c\n"), std::runtime_error);
+    CHECK_THROWS_AS(readText("a b:c\n"), std::runtime_error);
+    CHECK_THROWS_AS(readText("a | x\nb\n"), std::runtime_error);
+    CHECK_THROWS_AS(readText("a | x\na:A\n"), std::runtime_error);
+    CHECK_THROWS_AS(readText("a | x\na x:\n"), std::runtime_error);
+    CHECK_THROWS_AS(readText("a | x\na a\n"), std::runtime_error);
+    CHECK_THROWS_AS(readText("a | x\na x:A x:B\n"), std::runtime_error);
+
+    // The error names the offending line
+    std::string message;
+    try {
+      readText("a b\n| Comment\na\nc\n");
+    } catch (const std::runtime_error& error) {
+      message = error.what();
+    }
+    CHECK_EQ(message, "Line 4: Unknown item 'c'");
+  }
+}
@@ -0,0 +1,120 @@
+#include "StructureFile.hpp"
+
+#include "AlgorithmC.hpp"
+#include "FileIo.hpp"
+#include "TemporaryDirectory.hpp"
+
+#include <algorithm>
+#include <doctest.h>
+#include <stdexcept>
+
+/** Checks that two structures have the same lists.
+ * @param structure The structure.
+ * @param expectedStructure The expected structure.
+ */
+template <std::signed_integral Index>
+void checkSameStructure(const BasicDancingCellsStructure<Index>& structure,
+                        const BasicDancingCellsStructure<Index>& expectedStructure) {
+  CHECK_EQ(structure.ITEM, expectedStructure.ITEM);
+  CHECK_EQ(structure.SET, expectedStructure.SET);
+  CHECK_EQ(structure.NODE, expectedStructure.NODE);
+  CHECK_EQ(structure.nodeOptionIndices, expectedStructure.nodeOptionIndices);
+  CHECK_EQ(structure.primaryItemsCount, expectedStructure.primaryItemsCount);
+  CHECK_EQ(structure.secondaryItemsCount, expectedStructure.secondaryItemsCount);
+  CHECK_EQ(structure.itemsCount, expectedStructure.itemsCount);
+  CHECK_EQ(structure.optionsCount, expectedStructure.optionsCount);
+}
+
+TEST_CASE("Structure File") {
+  TemporaryDirectory directory;
+  const auto structure = DancingCellsStructure(3,
+                                               2,
+                                               {
+                                                   {{0, 1, {3, 3}, {4, 1}}}, // 'p q x:C y:A'
+                                                   {{0, 2, {3, 1}, {4, 3}}}, // 'p r x:A y:C'
+                                                   {}, // empty
+                                                   {{0, {3, 2}}}, // 'p x:B'
+                                                   {{1, {3, 1}}}, // 'q x:A'
+                                                   {{2, {4, 3}}}, // 'r y:C'
+                                               });
+
+  SUBCASE("Round trip") {
+    const auto path = directory.path() / "structure.xcc";
+    REQUIRE(StructureFile::write(path, structure));
+    const auto readStructure = StructureFile::read<int32_t>(path);
+    REQUIRE(readStructure.has_value());
+    checkSameStructure(readStructure.value(), structure);
+    CHECK_EQ(AlgorithmC::findAllSolutions(readStructure.value(), 0), AlgorithmC::findAllSolutions(structure, 0));
+
+    // The lists start at aligned addresses in the file
+    const auto file = FileIo::MappedFile::open(path);
+    REQUIRE(file.has_value());
+    CHECK_EQ(file->bytes().size() % StructureFile::sectionAlignment, 0);
+  }
+
+  SUBCASE("Round trip with compact indices") {
+    const auto compactStructure = CompactDancingCellsStructure(structure);
+    const auto path = directory.path() / "compact.xcc";
+    REQUIRE(StructureFile::write(path, compactStructure));
+    const auto readStructure = StructureFile::read<int16_t>(path);
+    REQUIRE(readStructure.has_value());
+    checkSameStructure(readStructure.value(), compactStructure);
+  }
+
+  SUBCASE("Round trip of an empty structure") {
+    const auto emptyStructure = DancingCellsStructure(0, 0, {});
+    const auto path = directory.path() / "empty.xcc";
+    REQUIRE(StructureFile::write(path, emptyStructure));
+    const auto readStructure = StructureFile::read<int32_t>(path);
+    REQUIRE(readStructure.has_value());
+    checkSameStructure(readStructure.value(), emptyStructure);
+  }
+
+  SUBCASE("Mapped lists are copied on write") {
+    const auto path = directory.path() / "structure.xcc";
+    REQUIRE(StructureFile::write(path, structure));
+    auto mappedStructure = StructureFile::MappedStructure<int32_t>::open(path);
+    REQUIRE(mappedStructure.has_value());
+    CHECK(std::ranges::equal(mappedStructure->ITEM, structure.ITEM));
+    CHECK(std::ranges::equal(mappedStructure->NODE, structure.NODE));
+
+    // Modifying the mapped lists, like Algorithm C does, leaves the file untouched
+    std::ranges::fill(mappedStructure->SET, 0);
+    CHECK(std::ranges::all_of(mappedStructure->createStructure().SET, [](int32_t value) { return value == 0; }));
+    const auto readStructure = StructureFile::read<int32_t>(path);
+    REQUIRE(readStructure.has_value());
+    checkSameStructure(readStructure.value(), structure);
+  }
+
+  SUBCASE("Invalid files") {
+    // Files that don't exist cannot be mapped
+    CHECK_FALSE(StructureFile::read<int32_t>(directory.path() / "NonExisting.xcc").has_value());
+    CHECK_FALSE(StructureFile::read<int32_t>(directory.path()).has_value());
+
+    const auto path = directory.path() / "structure.xcc";
+    REQUIRE(StructureFile::write(path, structure));
+    const auto contents = FileIo::read(path).value();
+
+    // Another index width
+    CHECK_THROWS_AS(StructureFile::read<int16_t>(path), std::runtime_error);
+
+    // Not a structure file
+    const auto textPath = directory.path() / "text.xcc";
+    REQUIRE(FileIo::write(textPath, std::string(contents.size(), 'a')));
+    CHECK_THROWS_AS(StructureFile::read<int32_t>(textPath), std::runtime_error);
+    REQUIRE(FileIo::write(textPath, ""));
+    CHECK_THROWS_AS(StructureFile::read<int32_t>(textPath), std::runtime_error);
+
+    // Truncated
+    const auto truncatedPath = directory.path() / "truncated.xcc";
+    REQUIRE(FileIo::write(truncatedPath, contents.substr(0, contents.size() - StructureFile::sectionAlignment)));
+    CHECK_THROWS_AS(StructureFile::read<int32_t>(truncatedPath), std::runtime_error);
+
+    // A single byte of the lists is changed
+    auto corruptedContents = contents;
+    corruptedContents[sizeof(StructureFile::Header) + 1] ^= 1;
+    const auto corruptedPath = directory.path() / "corrupted.xcc";
+    REQUIRE(FileIo::write(corruptedPath, corruptedContents));
+    CHECK_THROWS_AS(StructureFile::read<int32_t>(corruptedPath), std::runtime_error);
+  }
+}
@@ -0,0 +1,50 @@
+#include "XccOptions.hpp"
+
+#include <doctest.h>
+#include <vector>
+
+TEST_CASE("Xcc Options") {
+
+  SUBCASE("Empty options") {
+    const XccOptions options;
+    CHECK(options.empty());
+    CHECK_EQ(options.size(), 0);
+    CHECK_EQ(options.elementsCount(), 0);
+  }
+
+  SUBCASE("Building options") {
+    XccOptions options;
+    options.reserve(3, 4);
+    options.addElement(XccElement(0));
+    options.addElement(XccElement(2, 1));
+    options.finishOption();
+    // An option without any elements
+    options.finishOption();
+    options.addElement(XccElement(1));
+    options.addElement(XccElement(2, 3));
+    CHECK_EQ(options.size(), 2);
+    options.finishOption();
+
+    CHECK(!options.empty());
+    CHECK_EQ(options.size(), 3);
+    CHECK_EQ(options.elementsCount(), 4);
+    REQUIRE_EQ(options[0].size(), 2);
+    CHECK_EQ(options[0][0].id, 0);
+    CHECK_EQ(options[0][1].id, 2);
+    CHECK_EQ(options[0][1].colorId, 1);
+    CHECK(options[1].empty());
+    REQUIRE_EQ(options[2].size(), 2);
+    CHECK_EQ(options[2][0].id, 1);
+    CHECK_EQ(options[2][1].colorId, 3);
+  }
+
+  SUBCASE("Nested options") {
+    const auto options = XccOptions(std::vector<std::vector<XccElement>>{{0, 1}, {}, {{2, {3, 4}}}});
+    CHECK_EQ(options.size(), 3);
+    CHECK_EQ(options.elementsCount(), 4);
+    CHECK_EQ(options[0].size(), 2);
+    CHECK(options[1].empty());
+    CHECK_EQ(options[2][1].id, 3);
+    CHECK_EQ(options[2][1].colorId, 4);
+  }
+}
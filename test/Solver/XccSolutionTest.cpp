@@ -0,0 +1,38 @@
+#include "XccSolution.hpp"
+
+#include <doctest.h>
+#include <vector>
+
+TEST_CASE("Xcc Solution") {
+
+  SUBCASE("Empty solution") {
+    const XccSolution solution;
+    CHECK(solution.empty());
+    CHECK_EQ(solution.size(), 0);
+    CHECK(!solution.contains(0));
+    CHECK_EQ(solution, XccSolution({}));
+  }
+
+  SUBCASE("Options are sorted") {
+    const std::vector<int32_t> optionIndices = {7, 2, 11, 0};
+    const auto solution = XccSolution(optionIndices);
+    CHECK_EQ(solution.size(), 4);
+    CHECK_EQ(std::vector<int32_t>(solution.begin(), solution.end()), std::vector<int32_t>{0, 2, 7, 11});
+  }
+
+  SUBCASE("Contains") {
+    const XccSolution solution = {5, 1, 3};
+    for (const int32_t optionIndex : {1, 3, 5}) {
+      CHECK(solution.contains(optionIndex));
+    }
+    for (const int32_t optionIndex : {-1, 0, 2, 4, 6}) {
+      CHECK(!solution.contains(optionIndex));
+    }
+  }
+
+  SUBCASE("Equality does not depend on the order of the options") {
+    CHECK_EQ(XccSolution({1, 2, 3}), XccSolution({3, 1, 2}));
+    CHECK_NE(XccSolution({1, 2, 3}), XccSolution({1, 2}));
+    CHECK_NE(XccSolution({1, 2, 3}), XccSolution({1, 2, 4}));
+  }
+}
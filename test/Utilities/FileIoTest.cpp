@@ -2,7 +2,10 @@
 
 #include "TemporaryDirectory.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <doctest.h>
+#include <vector>
 
 TEST_CASE("FileIo") {
 
@@ -31,4 +34,35 @@ TEST_CASE("FileIo") {
     const auto nonExistingFile = directory.path() / "NonExisting.txt";
     CHECK_FALSE(FileIo::read(nonExistingFile));
   }
+
+  SUBCASE("Binary files") {
+    const auto filePath = directory.path() / "file.bin";
+    const auto bytes = std::vector<std::byte>{std::byte{0}, std::byte{1}, std::byte{255}, std::byte{'\n'}};
+    CHECK(FileIo::writeBytes(filePath, bytes));
+    CHECK_FALSE(FileIo::writeBytes(directory.path(), bytes));
+
+    auto file = FileIo::MappedFile::open(filePath);
+    REQUIRE(file.has_value());
+    CHECK(std::ranges::equal(file->bytes(), bytes));
+
+    // Modifying the mapped bytes leaves the file untouched
+    file->bytes()[0] = std::byte{7};
+    CHECK_EQ(file->bytes()[0], std::byte{7});
+    const auto otherFile = FileIo::MappedFile::open(filePath);
+    REQUIRE(otherFile.has_value());
+    CHECK(std::ranges::equal(otherFile->bytes(), bytes));
+
+    // Moving keeps the mapping
+    const auto movedFile = std::move(file.value());
+    CHECK_EQ(movedFile.bytes()[0], std::byte{7});
+
+    // Empty files are mapped as no bytes, directories and missing files are not mapped
+    const auto emptyFilePath = directory.path() / "empty.bin";
+    CHECK(FileIo::writeBytes(emptyFilePath, {}));
+    const auto emptyFile = FileIo::MappedFile::open(emptyFilePath);
+    REQUIRE(emptyFile.has_value());
+    CHECK(emptyFile->bytes().empty());
+    CHECK_FALSE(FileIo::MappedFile::open(directory.path()).has_value());
+    CHECK_FALSE(FileIo::MappedFile::open(directory.path() / "NonExisting.bin").has_value());
+  }
 }
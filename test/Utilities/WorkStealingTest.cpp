@@ -0,0 +1,68 @@
+#include "WorkStealing.hpp"
+
+#include <atomic>
+#include <doctest.h>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("Work Stealing") {
+
+  SUBCASE("Threads count") {
+    CHECK_EQ(WorkStealing::resolveThreadsCount(1), 1);
+    CHECK_EQ(WorkStealing::resolveThreadsCount(7), 7);
+    // Invalid amounts fall back to a single thread
+    CHECK_EQ(WorkStealing::resolveThreadsCount(0), 1);
+    CHECK_EQ(WorkStealing::resolveThreadsCount(-3), 1);
+    // Hardware concurrency
+    CHECK_GE(WorkStealing::resolveThreadsCount({}), 1);
+  }
+
+  SUBCASE("Every task runs exactly once") {
+    for (const int32_t threadsCount : {1, 2, 3, 8}) {
+      for (const std::size_t tasksCount : {0, 1, 2, 5, 100}) {
+        std::vector<std::atomic<int32_t>> runs(tasksCount);
+        WorkStealing::run(tasksCount, threadsCount, [&](std::size_t taskIndex) { runs[taskIndex]++; });
+        for (const auto& count : runs) {
+          CHECK_EQ(count.load(), 1);
+        }
+      }
+    }
+  }
+
+  SUBCASE("Tasks know their worker") {
+    for (const int32_t threadsCount : {1, 2, 3, 8}) {
+      // Every worker counts its own tasks, without synchronizing with the others
+      std::vector<int32_t> workerRuns(threadsCount, 0);
+      std::vector<std::atomic<int32_t>> runs(100);
+      WorkStealing::run(runs.size(), threadsCount, [&](std::size_t taskIndex, std::size_t workerIndex) {
+        REQUIRE(workerIndex < workerRuns.size());
+        workerRuns[workerIndex]++;
+        runs[taskIndex]++;
+      });
+      for (const auto& count : runs) {
+        CHECK_EQ(count.load(), 1);
+      }
+      CHECK_EQ(std::accumulate(workerRuns.begin(), workerRuns.end(), 0), 100);
+    }
+  }
+
+  SUBCASE("Exceptions are forwarded") {
+    for (const int32_t threadsCount : {1, 4}) {
+      std::atomic<int32_t> runsCount = 0;
+      CHECK_THROWS_AS(WorkStealing::run(10,
+                                        threadsCount,
+                                        [&](std::size_t taskIndex) {
+                                          runsCount++;
+                                          if (taskIndex == 3) {
+                                            throw std::runtime_error("Task failed");
+                                          }
+                                        }),
+                      std::runtime_error);
+      // With multiple threads the other tasks are still run
+      if (threadsCount > 1) {
+        CHECK_EQ(runsCount.load(), 10);
+      }
+    }
+  }
+}